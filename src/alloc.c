@@ -95,7 +95,9 @@ marlais_allocate_object (ObjectType type, size_t size)
     Object obj;
     /* allocate memory for the object */
 #ifndef SMALL_OBJECTS
-    obj = (Object) marlais_allocate_memory (sizeof (struct object));
+    /* only an instance's slots can go past the object */
+    obj = (Object) marlais_allocate_memory (size > sizeof (struct object)
+					    ? size : sizeof (struct object));
 #else
     obj = (Object) marlais_allocate_memory (size);
 #endif
@@ -117,3 +119,22 @@ marlais_allocate_strdup (const char *str)
 	/* return result */
     return copy;
 }
+
+void
+marlais_register_weak_link (void **link, void *obj)
+{
+    /* *link must not be traced, e.g. it lies in atomic memory */
+    GC_general_register_disappearing_link (link, obj);
+}
+
+void
+marlais_unregister_weak_link (void **link)
+{
+    GC_unregister_disappearing_link (link);
+}
+
+void
+marlais_collect_garbage (void)
+{
+    GC_gcollect ();
+}
@@ -48,6 +48,12 @@ extern void *marlais_allocate_atomic (size_t size);
 extern Object marlais_allocate_object (ObjectType type, size_t size);
 /* allocate copy of a zero-terminated string */
 extern char *marlais_allocate_strdup (const char *str);
+/* clear *link once obj is otherwise unreachable */
+extern void marlais_register_weak_link (void **link, void *obj);
+/* stop clearing *link */
+extern void marlais_unregister_weak_link (void **link);
+/* run a full collection now */
+extern void marlais_collect_garbage (void);
 
 /* allocate a data structure */
 #define MARLAIS_ALLOCATE_STRUCT(type) \
@@ -0,0 +1,366 @@
+/* analyze.c -- see COPYRIGHT for use */
+
+/*
+ * One-time analysis of parsed forms.
+ *
+ * Every combination found in an expression position is replaced, in
+ * the cons cell that holds it, by a <code> node.  The node records
+ * whether the form is a constant, a special form (with its syntax
+ * function already looked up) or a plain call, so eval no longer has
+ * to rediscover what each form is every time it runs.
+ *
+ * Only positions known to hold expressions are rewritten; parameter
+ * lists, slot specifications, case match lists and the like are left
+ * alone since the syntax functions still inspect them as raw forms.
+ * Analyzing a form twice is harmless.
+ */
+
+#include "analyze.h"
+
+#include "alloc.h"
+#include "list.h"
+#include "symbol.h"
+#include "syntax.h"
+
+enum form_shape {
+    OpaqueShape,		/* no subexpressions we know about */
+    ArgsShape,			/* every operand is an expression */
+    BodyShape,			/* one non-expression, then a body */
+    BindShape,			/* (bind (binding ...) body ...) */
+    LocalBindShape,		/* ("local-bind (binding ...)) */
+    DefineShape,		/* (define var ... init) */
+    CaseShape,
+    SelectShape,
+    CondShape,
+    DotimesShape,
+    ForShape,
+    ForEachShape,
+    SetShape,
+    QuoteShape
+};
+
+struct analyze_entry {
+    char *name;
+    enum form_shape shape;
+    Object sym;
+};
+
+static struct analyze_entry analyze_table[] =
+{
+    {"and", ArgsShape, NULL},
+    {"&", ArgsShape, NULL},
+    {"begin", ArgsShape, NULL},
+    {"if", ArgsShape, NULL},
+    {"or", ArgsShape, NULL},
+    {"|", ArgsShape, NULL},
+    {"unless", ArgsShape, NULL},
+    {"until", ArgsShape, NULL},
+    {"while", ArgsShape, NULL},
+    {"unwind-protect", ArgsShape, NULL},
+    {"bind-exit", BodyShape, NULL},
+    {"bind-methods", BodyShape, NULL},
+    {"\"unbinding-begin", BodyShape, NULL},
+    {"bind", BindShape, NULL},
+    {"\"local-bind", LocalBindShape, NULL},
+    {"\"local-bind-rec", LocalBindShape, NULL},
+    {"define", DefineShape, NULL},
+    {"define-variable", DefineShape, NULL},
+    {"define-constant", DefineShape, NULL},
+    {"case", CaseShape, NULL},
+    {"select", SelectShape, NULL},
+    {"cond", CondShape, NULL},
+    {"dotimes", DotimesShape, NULL},
+    {"for", ForShape, NULL},
+    {"for-each", ForEachShape, NULL},
+    {"set!", SetShape, NULL},
+    {"quote", QuoteShape, NULL},
+};
+
+#define ANALYZE_TABLE_SIZE (sizeof (analyze_table) / sizeof (struct analyze_entry))
+
+/* local function prototypes */
+static enum form_shape form_shape (Object op);
+static Object make_code (enum code_kind kind, Object form);
+static Object analyze_syntax (Object form, syntax_fun sf);
+static void analyze_car (Object cell);
+static void analyze_last (Object list);
+static void analyze_for_clauses (Object clauses);
+
+void
+init_analyze (void)
+{
+    int i;
+
+    for (i = 0; i < ANALYZE_TABLE_SIZE; ++i) {
+	analyze_table[i].sym = make_symbol (analyze_table[i].name);
+    }
+}
+
+Object
+analyze (Object form)
+{
+    Object op, code;
+    syntax_fun sf;
+
+    if (!PAIRP (form)) {
+	return (form);
+    }
+    op = CAR (form);
+    if (SYMBOLP (op) && (sf = syntax_function (op))) {
+	return analyze_syntax (form, sf);
+    }
+    analyze_car (form);
+    analyze_body (CDR (form));
+
+    code = make_code (CallCode, form);
+    CODEOPERATOR (code) = CAR (form);
+    CODEOPERANDS (code) = CDR (form);
+    return (code);
+}
+
+/* analyze each element of a list of expressions in place. */
+Object
+analyze_body (Object body)
+{
+    Object forms;
+
+    for (forms = body; PAIRP (forms); forms = CDR (forms)) {
+	analyze_car (forms);
+    }
+    return (body);
+}
+
+/* objects eval returns unchanged. */
+int
+self_evaluating_p (Object obj)
+{
+#ifdef SMALL_OBJECTS
+    if (INTEGERP (obj) || IMMEDP (obj)) {
+	return (1);
+    }
+#endif
+    switch (object_type (obj)) {
+    case True:
+    case False:
+    case Integer:
+#ifdef BIG_INTEGERS
+    case BigInteger:
+#endif
+    case Ratio:
+    case SingleFloat:
+    case DoubleFloat:
+    case ByteString:
+    case SimpleObjectVector:
+    case Keyword:
+    case Character:
+    case EndOfFile:
+    case EmptyList:
+    case ForeignPtr:
+	return (1);
+    default:
+	return (0);
+    }
+}
+
+static enum form_shape
+form_shape (Object op)
+{
+    int i;
+
+    for (i = 0; i < ANALYZE_TABLE_SIZE; ++i) {
+	if (analyze_table[i].sym == op) {
+	    return (analyze_table[i].shape);
+	}
+    }
+    return (OpaqueShape);
+}
+
+static Object
+make_code (enum code_kind kind, Object form)
+{
+    Object obj;
+
+    obj = marlais_allocate_object (Code, sizeof (struct code));
+
+    CODEKIND (obj) = kind;
+    CODEFORM (obj) = form;
+    CODEVALUE (obj) = NULL;
+    CODEOPERATOR (obj) = NULL;
+    CODEOPERANDS (obj) = NULL;
+    CODESYNTAX (obj) = NULL;
+    return (obj);
+}
+
+static Object
+analyze_syntax (Object form, syntax_fun sf)
+{
+    Object code, rest, clauses, branch;
+
+    rest = CDR (form);
+    switch (form_shape (CAR (form))) {
+    case ArgsShape:
+	analyze_body (rest);
+	break;
+    case BodyShape:
+	if (PAIRP (rest)) {
+	    analyze_body (CDR (rest));
+	}
+	break;
+    case BindShape:
+	if (PAIRP (rest)) {
+	    analyze_body (CDR (rest));
+	}
+	/* fall through */
+    case LocalBindShape:
+	if (PAIRP (rest)) {
+	    for (clauses = CAR (rest); PAIRP (clauses); clauses = CDR (clauses)) {
+		analyze_last (CAR (clauses));
+	    }
+	}
+	break;
+    case DefineShape:
+	analyze_last (rest);
+	break;
+    case CaseShape:
+	/* (case target (match-list consequent ...) ...) */
+	if (PAIRP (rest)) {
+	    analyze_car (rest);
+	    for (clauses = CDR (rest); PAIRP (clauses); clauses = CDR (clauses)) {
+		if (PAIRP (CAR (clauses))) {
+		    analyze_body (CDR (CAR (clauses)));
+		}
+	    }
+	}
+	break;
+    case SelectShape:
+	/* (select target test (match-list consequent ...) ...),
+	   the elements of a match list are evaluated. */
+	if (PAIRP (rest) && PAIRP (CDR (rest))) {
+	    analyze_car (rest);
+	    analyze_car (CDR (rest));
+	    for (clauses = CDR (CDR (rest)); PAIRP (clauses); clauses = CDR (clauses)) {
+		branch = CAR (clauses);
+		if (PAIRP (branch)) {
+		    analyze_body (CAR (branch));
+		    analyze_body (CDR (branch));
+		}
+	    }
+	}
+	break;
+    case CondShape:
+	for (clauses = rest; PAIRP (clauses); clauses = CDR (clauses)) {
+	    analyze_body (CAR (clauses));
+	}
+	break;
+    case DotimesShape:
+	/* (dotimes (var count [result]) body ...) */
+	if (PAIRP (rest)) {
+	    if (PAIRP (CAR (rest))) {
+		analyze_body (CDR (CAR (rest)));
+	    }
+	    analyze_body (CDR (rest));
+	}
+	break;
+    case ForShape:
+	/* (for (clause ...) (test result ...) body ...) */
+	if (PAIRP (rest) && PAIRP (CDR (rest))) {
+	    analyze_for_clauses (CAR (rest));
+	    analyze_body (CAR (CDR (rest)));
+	    analyze_body (CDR (CDR (rest)));
+	}
+	break;
+    case ForEachShape:
+	/* (for-each ((var collection) ...) (test result ...) body ...) */
+	if (PAIRP (rest) && PAIRP (CDR (rest))) {
+	    for (clauses = CAR (rest); PAIRP (clauses); clauses = CDR (clauses)) {
+		if (PAIRP (CAR (clauses))) {
+		    analyze_body (CDR (CAR (clauses)));
+		}
+	    }
+	    analyze_body (CAR (CDR (rest)));
+	    analyze_body (CDR (CDR (rest)));
+	}
+	break;
+    case SetShape:
+	if (!PAIRP (rest) || !PAIRP (CDR (rest))) {
+	    break;
+	}
+	if (PAIRP (CAR (rest)) && SYMBOLP (CAR (CAR (rest)))) {
+	    /* (set! (getter arg ...) val) is (getter-setter val arg ...) */
+	    code = make_code (CallCode, form);
+	    CODEOPERATOR (code) = make_setter_symbol (CAR (CAR (rest)));
+	    CODEOPERANDS (code) =
+		analyze_body (cons (CAR (CDR (rest)), CDR (CAR (rest))));
+	    return (code);
+	}
+	analyze_body (CDR (rest));
+	break;
+    case QuoteShape:
+	if (PAIRP (rest)) {
+	    code = make_code (ConstantCode, form);
+	    CODEVALUE (code) = CAR (rest);
+	    return (code);
+	}
+	break;
+    case OpaqueShape:
+	break;
+    }
+    code = make_code (SyntaxCode, form);
+    CODESYNTAX (code) = sf;
+    return (code);
+}
+
+static void
+analyze_car (Object cell)
+{
+    CAR (cell) = analyze (CAR (cell));
+}
+
+/* analyze the final element of a binding or definition. */
+static void
+analyze_last (Object list)
+{
+    if (!PAIRP (list)) {
+	return;
+    }
+    while (PAIRP (CDR (list))) {
+	list = CDR (list);
+    }
+    analyze_car (list);
+}
+
+/* for clauses are (var init step), (range: var start [to bound] [by inc])
+   or (collection: var collection). */
+static void
+analyze_for_clauses (Object clauses)
+{
+    Object clause, rest;
+
+    for (; PAIRP (clauses); clauses = CDR (clauses)) {
+	clause = CAR (clauses);
+	if (!PAIRP (clause) || !PAIRP (CDR (clause))) {
+	    continue;
+	}
+	if (CAR (clause) == range_keyword) {
+	    rest = CDR (CDR (clause));
+	    if (!PAIRP (rest)) {
+		continue;
+	    }
+	    analyze_car (rest);
+	    rest = CDR (rest);
+	    if (PAIRP (rest) && PAIRP (CDR (rest)) &&
+		(CAR (rest) == to_symbol || CAR (rest) == above_symbol ||
+		 CAR (rest) == below_symbol)) {
+		analyze_car (CDR (rest));
+		rest = CDR (CDR (rest));
+	    }
+	    if (PAIRP (rest) && PAIRP (CDR (rest)) && CAR (rest) == by_symbol) {
+		analyze_car (CDR (rest));
+	    }
+	} else if (CAR (clause) == collection_keyword) {
+	    analyze_body (CDR (CDR (clause)));
+	} else {
+	    analyze_body (CDR (clause));
+	}
+    }
+}
@@ -0,0 +1,13 @@
+/* analyze.h -- see COPYRIGHT for use */
+
+#ifndef ANALYZE_H
+#define ANALYZE_H
+
+#include "common.h"
+
+void init_analyze (void);
+Object analyze (Object form);
+Object analyze_body (Object body);
+int self_evaluating_p (Object obj);
+
+#endif
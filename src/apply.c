@@ -1,8 +1,11 @@
 /* apply.c -- see COPYRIGHT for use */
 
+#include <string.h>
+
 #include "apply.h"
 
 #include "alloc.h"
+#include "bytecode.h"
 #include "class.h"
 #include "env.h"
 #include "eval.h"
@@ -13,30 +16,47 @@
 #include "number.h"
 #include "print.h"
 #include "prim.h"
+#include "slot.h"
 #include "stream.h"
 #include "symbol.h"
 #include "syntax.h"
-#include "table.h"
 #include "values.h"
-#include "vector.h"
 
 /* global data */
 int trace_functions = 0;
 int trace_only_user_funs = 0;
 int trace_level = 0;
-Object ResultValueStack;
+int dispatch_epoch = 0;
+struct result_types *result_types = NULL;
+int result_types_depth = 0;
+static int result_types_size = 0;
+
+#define RESULT_TYPES_INITIAL_SIZE 256
+
+/* keyword arguments of a call are gathered on the C stack when the
+   method has at most KEY_BUF_SIZE keyword parameters. */
+#define KEY_BUF_SIZE 32
+#define KEY_BITS (8 * sizeof (unsigned long))
+#define KEY_WORDS(n) (((n) + KEY_BITS - 1) / KEY_BITS)
+#define KEY_SUPPLIED_P(bits, k) ((bits)[(k) / KEY_BITS] & (1UL << ((k) % KEY_BITS)))
 
 /* local function prototypes and data */
 
-Object apply_generic (Object gen, Object args);
-static void narrow_value_types (Object *values_list,
-				Object new_values_list,
-				Object *rest_type,
-				Object new_rest_type);
-static Object apply_exit (Object exit_proc, Object args);
-static Object apply_next_method (Object next_method, Object args);
+Object apply_generic (Object gen, int argc, Object *argv);
+static Object apply_exit (Object exit_proc, int argc, Object *argv);
+static Object apply_next_method (Object next_method, int argc, Object *argv);
+static Object generic_method (Object gen, int argc, Object *argv,
+			      Object *rest_methods, int *by_classes);
+#if defined(USE_CONTINUATION_STACK) && defined(USE_METHOD_CACHING)
+static Object call_cache_method (struct call_cache *cache, Object gen,
+				 int argc, Object *argv,
+				 Object *rest_methods);
+#endif
+static Object next_method_method (Object next_method, int *argc,
+				  Object **argv, Object *buf,
+				  Object *rest_methods);
 static Object set_trace (Object bool);
-static void devalue_args (Object args);
+static void devalue_args (int argc, Object *argv);
 static Object user_keyword;
 
 /* primitives */
@@ -60,17 +80,47 @@ init_apply_prims (void)
     init_prims (num, apply_prims);
 
     user_keyword = make_keyword ("user:");
-    ResultValueStack = make_empty_list ();
 }
 
-Object
-default_result_value (void)
+/* a combination accepts any values until a method narrows them. */
+void
+push_result_types (void)
 {
-    return cons (make_empty_list (), object_class);
+    struct result_types *types;
+
+    if (result_types_depth == result_types_size) {
+	result_types_size = (result_types_size ? 2 * result_types_size
+			     : RESULT_TYPES_INITIAL_SIZE);
+	result_types = (struct result_types *)
+	    marlais_reallocate_memory (result_types,
+				       result_types_size
+				       * sizeof (struct result_types));
+    }
+    types = &result_types[result_types_depth++];
+    types->required = make_empty_list ();
+    types->rest = object_class;
 }
 
+/* meth's last form is about to replace its call: make the current
+   combination check what meth declares it returns. */
+void
+narrow_result_types (Object meth)
+{
+    struct result_types *types;
+
+    if (EMPTYLISTP (METHREQVALUES (meth))
+	&& METHRESTVALUES (meth) == object_class) {
+	return;
+    }
+    types = &result_types[result_types_depth - 1];
+    narrow_value_types (&types->required, METHREQVALUES (meth),
+			&types->rest, METHRESTVALUES (meth));
+}
+
+/* apply fun to the argc arguments in argv, which it may overwrite
+   with their first values. */
 Object
-apply_internal (Object fun, Object args)
+apply_internal (Object fun, int argc, Object *argv)
 {
     Object ret;
 
@@ -84,7 +134,8 @@ apply_internal (Object fun, Object args)
 	    }
 	    marlais_print_object (marlais_standard_output, fun, 1);
 	    printf (" called with ");
-	    marlais_print_object (marlais_standard_output, args, 1);
+	    marlais_print_object (marlais_standard_output,
+				  list_from_array (argc, argv), 1);
 	    printf ("\n");
 	    trace_level++;
 	}
@@ -95,22 +146,22 @@ apply_internal (Object fun, Object args)
     }
 #endif
 
-    devalue_args (args);
+    devalue_args (argc, argv);
     switch (POINTERTYPE (fun)) {
     case Primitive:
-	ret = apply_prim (fun, args);
+	ret = apply_prim (fun, argc, argv);
 	break;
     case Method:
-	ret = apply_method (fun, args, make_empty_list (), NULL);
+	ret = apply_method (fun, argc, argv, make_empty_list (), NULL);
 	break;
     case GenericFunction:
-	ret = apply_generic (fun, args);
+	ret = apply_generic (fun, argc, argv);
 	break;
     case NextMethod:
-	ret = apply_next_method (fun, args);
+	ret = apply_next_method (fun, argc, argv);
 	break;
     case Exit:
-	ret = apply_exit (fun, args);
+	ret = apply_exit (fun, argc, argv);
 	break;
     default:
 	marlais_error ("apply: cannot apply this object", fun, NULL);
@@ -120,6 +171,9 @@ apply_internal (Object fun, Object args)
 
 	if ((!trace_only_user_funs) || (!PRIMP (fun))) {
 	    trace_level--;
+	}
+	if (ret != tail_call_object
+	    && ((!trace_only_user_funs) || (!PRIMP (fun)))) {
 	    printf ("; ");
 	    for (i = 0; i < trace_level; ++i) {
 		printf ("-");
@@ -134,20 +188,15 @@ apply_internal (Object fun, Object args)
 
 /* local functions */
 
-/*
- * It seems to me that apply method has gotten a little big.
- * It could benefit from modularizing in a rewrite.
- *              -jnw
- */
+/* apply meth to the argc arguments in argv: bind them, run its body
+   and put the environment back.  rest_methods are the methods
+   next-method goes on to when meth is applied by generic_apply. */
 Object
-apply_method (Object meth, Object args, Object rest_methods, Object generic_apply)
+apply_method (Object meth, int argc, Object *argv,
+	      Object rest_methods, Object generic_apply)
 {
-    Object params, param, sym, val, body, ret;
-    Object dup_list;
-    Object rest_var, class, keyword, keys;
-    Object *tmp_ptr;
-    int hit_rest, hit_key, hit_values;
-    struct frame *old_env;
+    Object body, ret;
+    struct method_call call;
 
     if (trace_functions && trace_level) {
 	int i;
@@ -160,56 +209,88 @@ apply_method (Object meth, Object args, Object rest_methods, Object generic_appl
 	    printf ("apply-method applying ");
 	    marlais_print_object (marlais_standard_output, meth, 1);
 	    printf (" with args ");
-	    marlais_print_object (marlais_standard_output, args, 1);
+	    marlais_print_object (marlais_standard_output,
+				  list_from_array (argc, argv), 1);
 	    printf ("\n");
 	}
     }
     ret = unspecified_object;
-    params = METHREQPARAMS (meth);
     body = METHBODY (meth);
 
+    enter_method (&call, meth, argc, argv, rest_methods, generic_apply);
 
-    /* remember current environment and subsitute with
-       environment present at method creation time */
-    old_env = the_env;
-    the_env = METHENV (meth);
+#ifdef USE_BYTECODE
+    if (METHCODE (meth) && !trace_functions) {
+	ret = execute_bytecode (METHCODE (meth), meth);
+    } else
+#endif
+    while (!EMPTYLISTP (body)) {
+	Object form = CAR (body);
 
-    push_scope (meth);
+#ifdef OPTIMIZE_TAIL_CALLS
+	/* when in tail form, we use tail_eval */
+	if (EMPTYLISTP (CDR (body))) {
+	    if (trace_functions) {
+		if (!trace_only_user_funs)
+		    marlais_warning ("tail position: ", form, NULL);
+	    }
+	    /* tail recursion optimization. */
 
-#ifdef USE_METHOD_CACHING
-    /* next-method stuff only applies to generic function method */
-    if (generic_apply) {
+	    /* If return values of this method are narrower types
+	     * than what the current combination expects, trim it
+	     * down to match.
+	     */
+	    narrow_result_types (meth);
 
-	/* re-calculate next methods if invalidated. */
-	if (PAIRP (rest_methods) && CAR (rest_methods) == MARLAIS_FALSE) {
-	    rest_methods = recalc_next_methods (generic_apply, meth, args);
+	    ret = tail_eval (form);
+	} else {
+#endif
+
+	    ret = construct_return_values (eval (form),
+					   METHREQVALUES (meth),
+					   METHRESTVALUES (meth));
+#ifdef OPTIMIZE_TAIL_CALLS
 	}
 #endif
 
-	/* install of next method object if there are next methods */
-	if (PAIRP (rest_methods)) {
-	    /* check use of empty_list vs. NULL!! */
-	    Object next_method;
+	body = CDR (body);
+    }
 
-	    /* make next-method and push it into the GF list */
-	    next_method = make_next_method (generic_apply, rest_methods, args);
+    leave_method (&call);
+    return ret;
+}
 
-#ifdef USE_METHOD_CACHING
-	    /* push next method on active list */
-	    GFACTIVENM (generic_apply) =
-		cons (next_method, GFACTIVENM (generic_apply));
-#endif
+/* make meth's frame of bindings for argv the environment, saving in
+   call what leave_method must put back. */
+void
+enter_method (struct method_call *call, Object meth, int argc, Object *argv,
+	      Object rest_methods, Object generic_apply)
+{
+    Object params, param, sym, val;
+    Object all_args;
+    Object rest_var, class, keyword;
+    struct keyword_index *index;
+    struct key_param *key;
+    Object key_buf[KEY_BUF_SIZE], *key_vals;
+    unsigned long supplied_buf[KEY_WORDS (KEY_BUF_SIZE)], *supplied;
+    int i, k, base, hit_rest, hit_key, hit_values;
+
+    all_args = NULL;		/* made only if next methods want it */
+    params = METHREQPARAMS (meth);
+    call->generic = NULL;
+
+    /* remember current environment and subsitute with
+       environment present at method creation time */
+    call->old_env = the_env;
+    the_env = METHENV (meth);
+
+    push_sized_scope (meth, METHFRAMESIZE (meth));
 
-	    /* make constant binding for next method */
-	    add_binding (METHNEXTMETH (meth), next_method, 1, the_env);
-	}
-#ifdef USE_METHOD_CACHING
-    }
-#endif
     hit_rest = hit_key = hit_values = 0;
 
     /* first process required parameters */
-    while ((PAIRP (params) && PAIRP (args))
+    i = 0;
+    while ((PAIRP (params) && i < argc)
 	   && (!hit_rest) && (!hit_key) && !(hit_values)) {
 	param = CAR (params);
 	if (param == hash_rest_symbol) {
@@ -219,7 +300,7 @@ apply_method (Object meth, Object args, Object rest_methods, Object generic_appl
 	} else if (param == hash_values_symbol) {
 	    hit_values = 1;
 	} else {
-	    val = CAR (args);
+	    val = argv[i];
 	    if (SYMBOLP (param)) {
 		sym = param;
 	    } else {
@@ -231,75 +312,123 @@ apply_method (Object meth, Object args, Object rest_methods, Object generic_appl
 		}
 	    }
 	    add_binding (sym, val, 0, the_env);
-	    args = CDR (args);
+	    i++;
 	    params = CDR (params);
 	}
     }
     /* now process #rest and #key parameters */
 
     if ((rest_var = METHRESTPARAM (meth)) != NULL) {
-	add_binding (rest_var, args, 0, the_env);
+	add_binding (rest_var, list_from_array (argc - i, argv + i),
+		     0, the_env);
     }
-    if (PAIRP (METHKEYPARAMS (meth))) {
-	/* copy keys */
-	keys = copy_list (METHKEYPARAMS (meth));
-	dup_list = make_empty_list ();	/* For duplicate keywords */
 
-	/* Bind each of the keyword args that is present. */
-	while (!EMPTYLISTP (args)) {
-	    keyword = FIRST (args);
+    /* next-method is bound after the required and rest parameters so
+       that they keep the same position in every frame of meth. */
+#ifdef USE_METHOD_CACHING
+    /* next-method stuff only applies to generic function method
+       whose body can use it */
+    if (generic_apply && METHNEXTMETH (meth)) {
+
+	/* re-calculate next methods if invalidated. */
+	if (PAIRP (rest_methods) && CAR (rest_methods) == MARLAIS_FALSE) {
+	    all_args = list_from_array (argc, argv);
+	    rest_methods = recalc_next_methods (generic_apply, meth, all_args);
+	}
+#endif
+
+	/* install of next method object if there are next methods */
+	if (PAIRP (rest_methods) && METHNEXTMETH (meth)) {
+	    /* check use of empty_list vs. NULL!! */
+	    Object next_method;
+
+	    /* make next-method and push it into the GF list */
+	    if (!all_args) {
+		all_args = list_from_array (argc, argv);
+	    }
+	    next_method = make_next_method (generic_apply, rest_methods, all_args);
+
+#ifdef USE_METHOD_CACHING
+	    /* push next method on active list */
+	    GFACTIVENM (generic_apply) =
+		cons (next_method, GFACTIVENM (generic_apply));
+	    call->generic = generic_apply;
+#endif
+
+	    /* make constant binding for next method */
+	    add_binding (METHNEXTMETH (meth), next_method, 1, the_env);
+	}
+#ifdef USE_METHOD_CACHING
+    }
+#endif
+
+    if ((index = METHKEYINDEX (meth)) != NULL) {
+	if (index->count <= KEY_BUF_SIZE) {
+	    key_vals = key_buf;
+	    supplied = supplied_buf;
+	} else {
+	    key_vals = (Object *)
+		marlais_allocate_memory (index->count * sizeof (Object));
+	    supplied = (unsigned long *)
+		marlais_allocate_memory (KEY_WORDS (index->count)
+					 * sizeof (unsigned long));
+	}
+	memset (supplied, 0, KEY_WORDS (index->count) * sizeof (unsigned long));
+
+	/* Note each of the keyword args that is present. */
+	while (i < argc) {
+	    keyword = argv[i];
 	    if (!KEYWORDP (keyword)) {
 		/* jnw -- check this out! */
 		if (!rest_var) {
 		    marlais_error ("apply: argument to method must be keyword", meth, keyword, NULL);
 		} else {
-		    args = CDR (args);
+		    i++;
 		    continue;
 		}
 	    }
-	    val = SECOND (args);
-
-	    /* if keyword is in the keys list then
-	     * 1) add a binding for keyword to val
-	     * 2) remove the keyword entry from keys
-	     */
-
-	    for (tmp_ptr = &keys;
-		 PAIRP (*tmp_ptr);
-		 tmp_ptr = &CDR (*tmp_ptr)) {
-		if (CAR (CAR (*tmp_ptr)) == keyword) {
-		    break;
-		}
+	    if (i + 1 == argc) {
+		marlais_error ("apply: keyword has no associated argument value",
+			       keyword, NULL);
 	    }
-	    if (EMPTYLISTP (*tmp_ptr)) {
-		if (member (keyword, dup_list)) {
-		    marlais_warning ("Duplicate keyword value ignored",
-			     keyword,
-			     val,
-			     0);
-		} else if (!METHALLKEYS (meth)) {
+	    val = argv[i + 1];
+	    k = keyword_position (index, keyword);
+	    if (k < 0) {
+		if (!METHALLKEYS (meth)) {
 		    marlais_error ("apply: Keyword argument not in parameter list",
 			   keyword,
 			   0);
 		}
+	    } else if (KEY_SUPPLIED_P (supplied, k)) {
+		marlais_warning ("Duplicate keyword value ignored",
+			 keyword,
+			 val,
+			 0);
 	    } else {
-		add_binding (SECOND (CAR (*tmp_ptr)), val, 0, the_env);
-		dup_list = cons (keyword, dup_list);
-		*tmp_ptr = CDR (*tmp_ptr);
+		supplied[k / KEY_BITS] |= 1UL << (k % KEY_BITS);
+		key_vals[k] = val;
 	    }
-	    args = CDR (CDR (args));
+	    i += 2;
 	}
-	/* Bind the missing keyword args to default_object */
-	while (PAIRP (keys)) {
-	    add_binding (SECOND (CAR (keys)),
-			 eval (THIRD (CAR (keys))),
-			 0,
-			 the_env);
-	    keys = CDR (keys);
+	/* Bind the keyword params in order, reserving the slots of the
+	   missing ones, then evaluate their defaults into those slots */
+	base = the_env->size;
+	for (k = 0; k < index->count; ++k) {
+	    if (KEY_SUPPLIED_P (supplied, k)) {
+		add_binding (index->params[k].var, key_vals[k], 0, the_env);
+	    } else {
+		reserve_binding (the_env);
+	    }
+	}
+	for (k = 0; k < index->count; ++k) {
+	    key = &index->params[k];
+	    if (!KEY_SUPPLIED_P (supplied, k)) {
+		fill_binding (the_env->bindings[base + k], key->var,
+			      key->constant ? key->init : eval (key->init), 0);
+	    }
 	}
-
     }
-    if (PAIRP (args) && !rest_var) {
+    if (i < argc && !rest_var) {
 	/*
 	 * Shouldn't check for all args used if applying method through
 	 * a generic function or as a next method.
@@ -307,69 +436,34 @@ apply_method (Object meth, Object args, Object rest_methods, Object generic_appl
 	 */
 	if (METHALLKEYS (meth)) {
 	    /* skip rest of parameters if they are keywords */
-	    while (PAIRP (args)) {
-		if (!KEYWORDP (CAR (args))) {
-		    marlais_error ("apply: keyword argument expected", CAR (args),
+	    for (; i < argc; i += 2) {
+		if (!KEYWORDP (argv[i])) {
+		    marlais_error ("apply: keyword argument expected", argv[i],
 			   NULL);
-		} else if (!PAIRP (CDR (args))) {
+		} else if (i + 1 == argc) {
 		    marlais_error ("apply: keyword has no associated argument value",
-			   CAR (args), NULL);
+			   argv[i], NULL);
 		}
-		args = CDR (CDR (args));
 	    }
 	} else {
-	    marlais_error ("Arguments have no matching parameters", args, NULL);
+	    marlais_error ("Arguments have no matching parameters",
+			   list_from_array (argc - i, argv + i), NULL);
 	}
     }
     if (PAIRP (params)) {
 	marlais_error ("Required parameters have no matching arguments", params,
 	       NULL);
     }
-    while (!EMPTYLISTP (body)) {
-	Object form = CAR (body);
-
-#ifdef OPTIMIZE_TAIL_CALLS
-	/* when in tail form, we use tail_eval */
-	if (EMPTYLISTP (CDR (body))) {
-	    if (trace_functions) {
-		if (!trace_only_user_funs)
-		    marlais_warning ("tail position: ", form, NULL);
-		if (trace_level)
-		    --trace_level;
-	    }
-	    /* tail recursion optimization. */
-
-	    /* If return values of this method are narrower types
-	     * than what is currently on top of the ResultValueStack,
-	     * trim it down to match.
-	     */
-
-
-	    narrow_value_types (&CAR (CAR (ResultValueStack)),
-				METHREQVALUES (meth),
-				&CDR (CAR (ResultValueStack)),
-				METHRESTVALUES (meth));
-
-	    ret = tail_eval (form);
-	} else {
-#endif
-
-	    ret = construct_return_values (eval (form),
-					   METHREQVALUES (meth),
-					   METHRESTVALUES (meth));
-#ifdef OPTIMIZE_TAIL_CALLS
-	}
-#endif
-
-	body = CDR (body);
-    }
+}
 
+/* undo what enter_method did. */
+void
+leave_method (struct method_call *call)
+{
 #ifdef USE_METHOD_CACHING
     /* pop out the next method that I put in the GF. */
-    if (generic_apply && PAIRP (rest_methods)) {
-
-	/* case controlling push */
-	GFACTIVENM (generic_apply) = CDR (GFACTIVENM (generic_apply));
+    if (call->generic) {
+	GFACTIVENM (call->generic) = CDR (GFACTIVENM (call->generic));
     }
 #endif
 
@@ -378,12 +472,10 @@ apply_method (Object meth, Object args, Object rest_methods, Object generic_appl
 
     /* re-assert environment present at the beginning of this function
      */
-    the_env = old_env;
-
-    return ret;
+    the_env = call->old_env;
 }
 
-static void
+void
 narrow_value_types (Object *values_list_ptr,
 		    Object new_values_list,
 		    Object *rest_type,
@@ -451,15 +543,8 @@ construct_return_values (Object ret,
 			 Object required_values,
 			 Object rest_values)
 {
-    int i, j;
-    Object newret;
-
-    /* To save effort, I make sure the return is a VALUES object.
-     * This is a waste of effort and really ought to be fixed.
-     * <pcb> could at least wrap it in a stack variable to avoid an alloc.
-     */
-
-    ResultValueStack = cons (default_result_value (), ResultValueStack);
+    int i, j, num;
+    Object newret, *els;
 
     if (!ret) {
 	/*
@@ -468,35 +553,46 @@ construct_return_values (Object ret,
 	 */
 	marlais_error ("return value is invalid", NULL);
     }
-    if (!VALUESP (ret)) {
-	ret = make_values (listem (ret, NULL));
+    /* a single value is looked at in place rather than in a VALUES
+       object made for it. */
+    if (VALUESP (ret)) {
+	els = VALUESELS (ret);
+	num = VALUESNUM (ret);
+    } else {
+	els = &ret;
+	num = 1;
+    }
+    if (EMPTYLISTP (required_values) && rest_values == object_class) {
+	/* nothing declared, nothing to check */
+	return (num == 1 ? els[0] : ret);
     }
-    /* check return values (not done for non VALUESTYPE values yet */
     for (i = 0;
-	 i < VALUESNUM (ret) && PAIRP (required_values);
+	 i < num && PAIRP (required_values);
 	 i++, required_values = CDR (required_values)) {
-	if (!instance (VALUESELS (ret)[i], CAR (required_values))) {
+	if (!instance (els[i], CAR (required_values))) {
 	    marlais_error ("in value return: return value is not of correct type",
-		   VALUESELS (ret)[i], CAR (required_values), NULL);
+		   els[i], CAR (required_values), NULL);
 	}
     }
-    if (i < VALUESNUM (ret)) {
+    if (i < num) {
 	/* We have more return values than specific return types.
 	 * Check them against the #rest value return type
 	 */
 	if (rest_values != NULL) {
-	    for (; i < VALUESNUM (ret); i++) {
-		if (!instance (VALUESELS (ret)[i],
-			       rest_values)) {
+	    for (; i < num; i++) {
+		if (!instance (els[i], rest_values)) {
 		    marlais_error ("in value return: return value is not of correct type",
-			   VALUESELS (ret)[i],
+			   els[i],
 			   rest_values,
 			   NULL);
 		}
 	    }
-	} else {
+	} else if (VALUESP (ret)) {
 	    /* Discard the extra values by ignoring them. */
-	    VALUESNUM (ret) = i;
+	    VALUESNUM (ret) = num = i;
+	} else {
+	    /* no values at all */
+	    return (construct_values (0));
 	}
     } else if (PAIRP (required_values)) {
 	/* Add default values */
@@ -513,66 +609,169 @@ construct_return_values (Object ret,
 	VALUESELS (newret) = (Object *)
 	    marlais_allocate_memory (VALUESNUM (newret) * sizeof (Object));
 
-	for (i = 0; i < VALUESNUM (ret); i++) {
-	    VALUESELS (newret)[i] = VALUESELS (ret)[i];
+	for (i = 0; i < num; i++) {
+	    VALUESELS (newret)[i] = els[i];
 	}
 	for (; i < VALUESNUM (newret); i++) {
 	    VALUESELS (newret)[i] = MARLAIS_FALSE;
 	}
 	ret = newret;
+	els = VALUESELS (newret);
+	num = VALUESNUM (newret);
     }
     /* turn stupid multiple value into single value */
-    if (VALUESNUM (ret) == 1) {
-	ret = VALUESELS (ret)[0];
-    }
-    ResultValueStack = CDR (ResultValueStack);
-    return (ret);
+    return (num == 1 ? els[0] : ret);
 }
 
 #ifdef USE_METHOD_CACHING
-static Object
-get_specializers (Object gen, Object args)
-/* Construct vector of classes of agruments */
+/* A generic function's dispatch tree.  The root branches on the class
+   of the first required argument, by CLASSINDEX, its children on the
+   second, and so on.  Below the last required argument is a leaf with
+   the sorted method handles possible for those classes.  If they are
+   all specialized on classes, the classes alone decide the method and
+   the leaf keeps it.  add_method and remove_method drop the tree, and
+   calls build what they need of it again. */
+struct dispatch_node {
+    Object entry;		/* at a leaf, the sorted method handles */
+    Object method;		/* or NULL if the arguments must be tested */
+    Object rest_methods;
+    int size;
+    struct dispatch_node **branches;
+};
+
+static struct dispatch_node *make_dispatch_node (void);
+static struct dispatch_node **dispatch_branch (struct dispatch_node *node,
+					       Object class);
+static int class_specialized (Object entry);
+static Object entry_method (Object gen, Object entry, int argc, Object *argv,
+			    Object *tail);
+static Object build_rest_methods (Object cache_tail);
+
+/* the leaf of gen's dispatch tree for the classes of argv, built if
+   need be.  *nreq gets the number of required arguments. */
+static struct dispatch_node *
+dispatch_leaf (Object gen, int argc, Object *argv, int *nreq)
 {
-    int length, i;
-    Object result, tmp;
+    struct dispatch_node *node, **branch;
+    Object tail;
+    int i;
 
-    tmp = args;
-    length = list_length (function_specializers (gen));
-    result = marlais_make_vector (length, NULL);
-    for (i = 0; i < length; i++) {
-	if (EMPTYLISTP (tmp)) {
-	    marlais_error ("Missing Required Arguments", gen, args, NULL);
+    if (!GFDISPATCH (gen)) {
+	GFDISPATCH (gen) = make_dispatch_node ();
+    }
+    node = GFDISPATCH (gen);
+    if (argc < GFSIG (gen)->required) {
+	marlais_error ("Missing Required Arguments", gen,
+		       list_from_array (argc, argv), NULL);
+    }
+    for (i = 0; i < GFSIG (gen)->required; ++i) {
+	branch = dispatch_branch (node, objectclass (argv[i]));
+	if (!*branch) {
+	    *branch = make_dispatch_node ();
+	}
+	node = *branch;
+    }
+    *nreq = i;
+    if (!node->entry) {
+	node->entry = sorted_possible_method_handles (gen,
+					  list_from_array (argc, argv));
+	if (argc == i && class_specialized (node->entry)) {
+	    node->method = entry_method (gen, node->entry, argc, argv, &tail);
+	    node->rest_methods = build_rest_methods (tail);
 	}
-	SOVELS (result)[i] = objectclass (CAR (tmp));
-	tmp = CDR (tmp);
     }
-    return (result);
+    return (node);
 }
 
-static Object
-getCacheEntry (Object gen, Object args)
+static struct dispatch_node *
+make_dispatch_node (void)
+{
+    struct dispatch_node *node;
+
+    node = (struct dispatch_node *)
+	marlais_allocate_memory (sizeof (struct dispatch_node));
+    node->entry = NULL;
+    node->method = NULL;
+    node->rest_methods = NULL;
+    node->size = 0;
+    node->branches = NULL;
+    return (node);
+}
+
+/* where node keeps its child for arguments of class */
+static struct dispatch_node **
+dispatch_branch (struct dispatch_node *node, Object class)
 {
-    Object arg_vec, cacheEntry;
+    int index, size, i;
+
+    index = CLASSINDEX (class);
+    if (index >= node->size) {
+	size = last_class_index + 1;
+	node->branches = (struct dispatch_node **)
+	    marlais_reallocate_memory (node->branches,
+				       size * sizeof (struct dispatch_node *));
+	for (i = node->size; i < size; ++i) {
+	    node->branches[i] = NULL;
+	}
+	node->size = size;
+    }
+    return (&node->branches[index]);
+}
 
-    arg_vec = get_specializers (gen, args);
-    cacheEntry = table_element_by_vector (GFCACHE (gen), arg_vec);
-    return (cacheEntry);
+/* whether every method of entry has only classes as specializers */
+static int
+class_specialized (Object entry)
+{
+    struct signature *sig;
+    Object group;
+    int i;
+
+    for (; PAIRP (entry); entry = CDR (entry)) {
+	for (group = CAR (entry); PAIRP (group); group = CDR (group)) {
+	    sig = METHSIG (HDLOBJ (CAR (group)));
+	    for (i = 0; i < sig->required; ++i) {
+		if (!CLASSP (sig->specializers[i])) {
+		    return 0;
+		}
+	    }
+	}
+    }
+    return 1;
 }
 
+/* the first method of entry applicable to argv, with the groups after
+   its own in *tail. */
 static Object
-add_method_cache (Object gen, Object args)
+entry_method (Object gen, Object entry, int argc, Object *argv, Object *tail)
 {
-    Object arg_vec, new_item;
+    Object group, method;
 
-    arg_vec = get_specializers (gen, args);
-    new_item = sorted_possible_method_handles (gen, args);
-    table_element_setter_by_vector (GFCACHE (gen), arg_vec, new_item);
-    return (new_item);
+    method = NULL;
+    while (!EMPTYLISTP (entry)) {
+	for (group = CAR (entry); !EMPTYLISTP (group); group = CDR (group)) {
+	    if (applicable_method_argv (HDLOBJ (CAR (group)), argc, argv)) {
+		if (method) {
+		    marlais_error ("Ambiguous methods in apply generic function",
+				   gen, list_from_array (argc, argv), NULL);
+		} else {
+		    method = HDLOBJ (CAR (group));
+		}
+	    }
+	}
+	entry = CDR (entry);
+	if (method)
+	    break;
+    }
+    if (!method) {
+	marlais_error ("No applicable methods", gen,
+		       list_from_array (argc, argv), NULL);
+    }
+    *tail = entry;
+    return (method);
 }
 
 static Object
-build_rest_methods (Object cache_tail, Object args)
+build_rest_methods (Object cache_tail)
     /* build the next methods list */
 {
     Object method_found, method_group;
@@ -597,108 +796,209 @@ build_rest_methods (Object cache_tail, Object args)
     if (!method_found) {
 	return cons (MARLAIS_FALSE, make_empty_list ());
     } else {
-	return cons (method_found, build_rest_methods (CDR (cache_tail), args));
+	return cons (method_found, build_rest_methods (CDR (cache_tail)));
     }
 }
 #endif
 
-Object
-apply_generic (Object gen, Object args)
+/* the method gen applies to argv, with the methods next-method goes
+   on to from it in *rest_methods.  *by_classes, if wanted, is set if
+   the classes of argv alone decide them. */
+static Object
+generic_method (Object gen, int argc, Object *argv, Object *rest_methods,
+		int *by_classes)
 {
-
-#ifndef USE_METHOD_CACHING
-    Object sorted_methods;
-    Object methods;
-
-#endif
-    Object cacheEntry;
-    Object currentGroup;
-    Object method;
-    Object rest_methods;
-
 #ifdef USE_METHOD_CACHING
-    /* try the cache first */
-    cacheEntry = getCacheEntry (gen, args);
-    if (!cacheEntry) {
-	/* add the cache entry if it isn't there */
-	cacheEntry = add_method_cache (gen, args);
-    }
-    method = NULL;
-    /* find the first applicable method */
-    while (!EMPTYLISTP (cacheEntry)) {
-	currentGroup = CAR (cacheEntry);
-	while (!EMPTYLISTP (currentGroup)) {
-	    if (applicable_method_p (HDLOBJ (CAR (currentGroup)), args, 0)
-		== MARLAIS_TRUE) {
-		if (method) {
-		    marlais_error ("Ambiguous methods in apply generic function", gen, args, NULL);
-		} else {
-		    method = HDLOBJ (CAR (currentGroup));
-		}
-	    }
-	    currentGroup = CDR (currentGroup);
+    struct dispatch_node *leaf;
+    Object method, tail;
+    int nreq;
+
+    leaf = dispatch_leaf (gen, argc, argv, &nreq);
+    if (leaf->method && argc == nreq) {
+	if (by_classes) {
+	    *by_classes = 1;
 	}
-	cacheEntry = CDR (cacheEntry);
-	if (method)
-	    break;
+	*rest_methods = leaf->rest_methods;
+	return (leaf->method);
     }
-    if (!method) {
-	marlais_error ("No applicable methods", gen, args, NULL);
+    if (by_classes) {
+	*by_classes = 0;
     }
-    rest_methods = build_rest_methods (cacheEntry, args);
-    return apply_method (method, args, rest_methods, gen);
+    method = entry_method (gen, leaf->entry, argc, argv, &tail);
+    *rest_methods = build_rest_methods (tail);
+    return (method);
 #else
-    methods = GFMETHODS (gen);
-    sorted_methods = FIRSTVAL (sorted_applicable_methods (gen, args));
+    Object sorted_methods;
+
+    sorted_methods = FIRSTVAL (sorted_applicable_methods (gen,
+				list_from_array (argc, argv)));
     if (EMPTYLISTP (sorted_methods)) {
-	marlais_error ("Ambiguous methods in apply generic function", gen, args, NULL);
-    } else {
-	return apply_method (CAR (sorted_methods),
-			     args,
-			     CDR (sorted_methods),
-			     gen);
+	marlais_error ("Ambiguous methods in apply generic function", gen,
+		       list_from_array (argc, argv), NULL);
     }
+    *rest_methods = CDR (sorted_methods);
+    return (CAR (sorted_methods));
 #endif
 }
 
+Object
+apply_generic (Object gen, int argc, Object *argv)
+{
+    Object method, rest_methods;
+
+    method = generic_method (gen, argc, argv, &rest_methods, NULL);
+    /* a slot accessor needs no frame */
+    if (METHACCESSOR (method) && !trace_functions) {
+	return apply_slot_accessor (method, argv);
+    }
+    return apply_method (method, argc, argv, rest_methods, gen);
+}
+
 static Object
-apply_exit (Object exit_proc, Object args)
+apply_exit (Object exit_proc, int argc, Object *argv)
 {
     if (unwind_to_exit (exit_proc)) {
-	switch (list_length (args)) {
+	switch (argc) {
 	case 0:
 	    longjmp (*EXITRET (exit_proc), (int) (unspecified_object));
 	case 1:
-	    longjmp (*EXITRET (exit_proc), (int) FIRST (args));
+	    longjmp (*EXITRET (exit_proc), (int) argv[0]);
 	default:
-	    longjmp (*EXITRET (exit_proc), (int) (values (args)));
+	    longjmp (*EXITRET (exit_proc),
+		     (int) (values (list_from_array (argc, argv))));
 	}
     } else {
 	return marlais_error ("No exit procedure binding -- returning", 0);
     }
 }
 
+/* the method next_method stands for, with the methods after it in
+   *rest_methods.  called with no arguments it passes on the ones it
+   was made with, copied to buf. */
 static Object
-apply_next_method (Object next_method, Object args)
+next_method_method (Object next_method, int *argc, Object **argv,
+		    Object *buf, Object *rest_methods)
 {
-    Object method, rest_methods, real_args;
+    Object method;
 
-    rest_methods = NMREST (next_method);
+    *rest_methods = NMREST (next_method);
 #ifdef USE_METHOD_CACHING
     method = NMMETH (next_method);
 #else
-    method = CAR (rest_methods);
-    rest_methods = CDR (rest_methods);
+    method = CAR (*rest_methods);
+    *rest_methods = CDR (*rest_methods);
 #endif
 
-    if (EMPTYLISTP (args)) {
-	real_args = NMARGS (next_method);
-    } else {
-	real_args = args;
+    if (*argc == 0) {
+	*argv = list_to_array (NMARGS (next_method), argc,
+			       buf, MAX_STACK_ARGS);
     }
-    return apply_method (method, real_args, rest_methods, NMGF (next_method));
+    return (method);
 }
 
+static Object
+apply_next_method (Object next_method, int argc, Object *argv)
+{
+    Object method, rest_methods;
+    Object buf[MAX_STACK_ARGS];
+
+    method = next_method_method (next_method, &argc, &argv, buf,
+				 &rest_methods);
+    return apply_method (method, argc, argv, rest_methods, NMGF (next_method));
+}
+
+void
+init_call_cache (struct call_cache *cache)
+{
+    cache->epoch = dispatch_epoch;
+    cache->count = 0;
+}
+
+#ifdef USE_CONTINUATION_STACK
+/* the method applying fun to argv would run, with the methods after
+   it and the generic function choosing it, or NULL if it would run
+   anything else.  argv is left as that method takes it, in buf when
+   they are a next method's own, and applying fun to it instead does
+   the same.  cache, if any, is the call site's. */
+Object
+dispatch_method (Object fun, struct call_cache *cache, int *argc,
+		 Object **argv, Object *buf, Object *rest_methods,
+		 Object *generic)
+{
+    if (trace_functions) {
+	return (NULL);
+    }
+#ifdef SMALL_OBJECTS
+    if (!POINTERP (fun)) {
+	return (NULL);
+    }
+#endif
+    devalue_args (*argc, *argv);
+    switch (POINTERTYPE (fun)) {
+    case Method:
+	*rest_methods = make_empty_list ();
+	*generic = NULL;
+	return (fun);
+    case GenericFunction:
+	*generic = fun;
+#ifdef USE_METHOD_CACHING
+	if (cache && *argc <= CALL_CACHE_CLASSES) {
+	    return call_cache_method (cache, fun, *argc, *argv, rest_methods);
+	}
+#endif
+	return generic_method (fun, *argc, *argv, rest_methods, NULL);
+    case NextMethod:
+	*generic = NMGF (fun);
+	return next_method_method (fun, argc, argv, buf, rest_methods);
+    default:
+	return (NULL);
+    }
+}
+
+#ifdef USE_METHOD_CACHING
+/* generic_method through the call site's cache. */
+static Object
+call_cache_method (struct call_cache *cache, Object gen, int argc,
+		   Object *argv, Object *rest_methods)
+{
+    struct call_cache_entry *entry;
+    Object classes[CALL_CACHE_CLASSES];
+    Object method;
+    int by_classes, i, j;
+
+    for (i = 0; i < argc; ++i) {
+	classes[i] = objectclass (argv[i]);
+    }
+    if (cache->epoch != dispatch_epoch) {
+	init_call_cache (cache);
+    }
+    for (i = 0, entry = cache->entries; i < cache->count; ++i, ++entry) {
+	if (entry->generic == gen) {
+	    for (j = 0; j < argc && entry->classes[j] == classes[j]; ++j)
+		;
+	    if (j == argc) {
+		*rest_methods = entry->rest_methods;
+		return (entry->method);
+	    }
+	}
+    }
+    method = generic_method (gen, argc, argv, rest_methods, &by_classes);
+    if (by_classes) {
+	/* when full, the latest entry makes way */
+	entry = &cache->entries[cache->count < CALL_CACHE_ENTRIES
+				? cache->count++ : CALL_CACHE_ENTRIES - 1];
+	entry->generic = gen;
+	for (i = 0; i < argc; ++i) {
+	    entry->classes[i] = classes[i];
+	}
+	entry->method = method;
+	entry->rest_methods = *rest_methods;
+    }
+    return (method);
+}
+#endif
+#endif
+
 static Object
 set_trace (Object flag)
 {
@@ -715,18 +1015,19 @@ set_trace (Object flag)
 }
 
 static void
-devalue_args (Object args)
+devalue_args (int argc, Object *argv)
 {
-    while (!EMPTYLISTP (args)) {
-	Object arg = CAR (args);
+    int i;
+
+    for (i = 0; i < argc; ++i) {
+	Object arg = argv[i];
 
 	if (VALUESP (arg)) {
 	    if (VALUESNUM (arg) > 0) {
-		CAR (args) = VALUESELS (arg)[0];
+		argv[i] = VALUESELS (arg)[0];
 	    } else {
 		marlais_error ("Null values construct used as an argument", NULL);
 	    }
 	}
-	args = CDR (args);
     }
 }
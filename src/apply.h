@@ -9,19 +9,85 @@
 extern int trace_functions;
 extern int trace_level;
 extern Object hash_values_symbol;
-extern Object ResultValueStack;
-Object default_result_value (void);
+
+/* the result types each combination being evaluated must return,
+   narrowed by the methods it tail calls.  a stack in an array, so
+   that keeping it costs no allocation. */
+struct result_types {
+    Object required;		/* types of the leading values */
+    Object rest;		/* type of any others, NULL if none */
+};
+
+extern struct result_types *result_types;
+extern int result_types_depth;
+
+/* what entering a method changed, for leaving it to put back. */
+struct method_call {
+    struct frame *old_env;
+    Object generic;		/* whose active next methods got one */
+};
+
+/* calls are made with their arguments in an array; calls with at
+   most this many keep it on the C stack. */
+#define MAX_STACK_ARGS 8
+
+/* the generic function dispatches a call site in bytecode has seen,
+   the first one it saw tried first; with USE_CONTINUATION_STACK they
+   pick the method without going through apply_generic.  only calls
+   of at most CALL_CACHE_CLASSES arguments whose classes decide the
+   method are kept.  an entry is good until dispatch_epoch moves on,
+   when methods or classes are added or methods removed. */
+#define CALL_CACHE_ENTRIES 4
+#define CALL_CACHE_CLASSES 3
+
+struct call_cache {
+    int epoch;
+    int count;
+    struct call_cache_entry {
+	Object generic;
+	Object classes[CALL_CACHE_CLASSES];
+	Object method;
+	Object rest_methods;
+    } entries[CALL_CACHE_ENTRIES];
+};
+
+extern int dispatch_epoch;
 
 /* external functions */
 void init_apply_prims (void);
 Object apply (Object fun, Object args);
-Object apply_internal (Object fun, Object args);
+Object apply_argv (Object fun, int argc, Object *argv);
+Object apply_internal (Object fun, int argc, Object *argv);
 Object apply_method (Object meth,
-		     Object args,
+		     int argc,
+		     Object *argv,
 		     Object rest_methods,
 		     Object generic_apply);
+void enter_method (struct method_call *call,
+		   Object meth,
+		   int argc,
+		   Object *argv,
+		   Object rest_methods,
+		   Object generic_apply);
+void leave_method (struct method_call *call);
+void init_call_cache (struct call_cache *cache);
+#ifdef USE_CONTINUATION_STACK
+Object dispatch_method (Object fun,
+			struct call_cache *cache,
+			int *argc,
+			Object **argv,
+			Object *buf,
+			Object *rest_methods,
+			Object *generic);
+#endif
 Object construct_return_values (Object ret,
 				Object required_values,
 				Object rest_values);
+void narrow_value_types (Object *values_list,
+			 Object new_values_list,
+			 Object *rest_type,
+			 Object new_rest_type);
+void push_result_types (void);
+void narrow_result_types (Object meth);
 
 #endif
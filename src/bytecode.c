@@ -0,0 +1,1213 @@
+/* bytecode.c -- see COPYRIGHT for use */
+
+/*
+ * Bytecode for method bodies.
+ *
+ * make_method compiles the (already analyzed) body of each method
+ * into a flat stream of register instructions which apply_method runs
+ * in execute_bytecode instead of walking the forms with eval.  Each
+ * instruction is an opcode followed by its operands; operands are
+ * register numbers, constant indices or code offsets.
+ *
+ * Calls, variable references, constants and the common control forms
+ * (if, begin, and, or, unless, while, until and set! of a variable)
+ * are compiled.  Any other form is kept as a constant and handed to
+ * eval (or tail_eval in tail position) by an EVAL instruction, so the
+ * tree walker stays the fallback for everything the compiler does
+ * not understand.
+ *
+ * The compiler also follows the frames the body creates at run time:
+ * the method's own frame of parameters and one frame per let or local
+ * method.  A reference to a variable bound in one of them is compiled
+ * to its lexical address, the number of frames out and the position of
+ * the binding in that frame, so it no longer searches every enclosing
+ * frame by name.  The address is checked against the symbol when it is
+ * used and the frame is searched if it doesn't match, since a frame
+ * such as the method's may not always hold the same bindings in the
+ * same order.  Any other variable is looked up starting from the
+ * environment of the method, unless the method was defined at top
+ * level: then it is a module variable and its binding, once found, is
+ * kept in the cell beside the symbol's constant.  Top level bindings
+ * are never replaced, so the cell stays good.  If some form makes the
+ * frames impossible to follow, the whole body is compiled again
+ * looking up every variable by name.
+ *
+ * With USE_CONTINUATION_STACK, a compiled method calling another one
+ * doesn't recurse in C.  Each running method has a continuation, its
+ * registers and where it goes on from, on a stack kept in chunks of
+ * the heap, and execute_bytecode switches between them itself; only
+ * calls into the tree walker, primitives and the like use the C
+ * stack.  Recursion between compiled methods is then bounded by
+ * memory, and the stack can be walked through continuation_top.
+ */
+
+#include "bytecode.h"
+
+#include "alloc.h"
+#include "analyze.h"
+#include "apply.h"
+#include "env.h"
+#include "error.h"
+#include "eval.h"
+#include "list.h"
+#include "slot.h"
+#include "symbol.h"
+#include "syntax.h"
+#include "values.h"
+
+enum opcode {
+    OP_CONST,			/* dst k */
+    OP_VARIABLE,		/* dst k */
+    OP_SET_VARIABLE,		/* dst k */
+    OP_LOCAL,			/* dst depth index k */
+    OP_SET_LOCAL,		/* dst depth index k */
+    OP_FREE_VARIABLE,		/* dst k */
+    OP_SET_FREE,		/* dst k */
+    OP_GLOBAL,			/* dst k */
+    OP_SET_GLOBAL,		/* dst k */
+    OP_PUSH_SCOPE,		/* dst k count */
+    OP_ENTER_SCOPE,		/* src */
+    OP_BIND,			/* frame k src */
+    OP_POP_SCOPES,		/* count */
+    OP_EVAL,			/* dst k */
+    OP_TAIL_EVAL,		/* k */
+    OP_CALL,			/* dst base argc site */
+    OP_TAIL_CALL,		/* base argc site */
+    OP_JUMP,			/* target */
+    OP_JUMP_FALSE,		/* src target */
+    OP_JUMP_TRUE,		/* src target */
+    OP_FIRST_VALUE,		/* reg */
+    OP_CHECK_VALUES,		/* reg */
+    OP_NARROW_VALUES,
+    OP_RETURN			/* src */
+};
+
+enum compiled_form {
+    NotCompiled, IfForm, BeginForm, AndForm, OrForm, UnlessForm,
+    WhileForm, UntilForm, SetForm, LocalBindForm, LocalBindRecForm,
+    UnbindingBeginForm
+};
+
+static struct {
+    char *name;
+    enum compiled_form form;
+    Object sym;
+} compiled_forms[] =
+{
+    {"if", IfForm, NULL},
+    {"begin", BeginForm, NULL},
+    {"and", AndForm, NULL},
+    {"&", AndForm, NULL},
+    {"or", OrForm, NULL},
+    {"|", OrForm, NULL},
+    {"unless", UnlessForm, NULL},
+    {"while", WhileForm, NULL},
+    {"until", UntilForm, NULL},
+    {"set!", SetForm, NULL},
+    {"\"local-bind", LocalBindForm, NULL},
+    {"\"local-bind-rec", LocalBindRecForm, NULL},
+    {"\"unbinding-begin", UnbindingBeginForm, NULL},
+};
+
+#define COMPILED_FORMS_SIZE (sizeof (compiled_forms) / sizeof (compiled_forms[0]))
+
+#ifdef USE_CONTINUATION_STACK
+/* a running compiled method.  its registers follow it. */
+struct continuation {
+    struct continuation *caller;	/* the one below, or NULL */
+    struct continuation_chunk *chunk;	/* the chunk holding it */
+    struct bytecode *bc;
+    Object meth;
+    Object *regs;
+    int *pc;			/* where to go on once a call returns */
+    int dst;			/* caller's register for the value */
+    int results;		/* result types depth of its call */
+    struct method_call call;
+};
+
+struct continuation_chunk {
+    struct continuation_chunk *next;
+    char *limit;
+};
+
+#define CONTINUATION_CHUNK_SIZE (64 * 1024)
+
+struct continuation *continuation_top = NULL;
+static struct continuation_chunk *first_continuation_chunk = NULL;
+#endif
+
+struct compiler {
+    int *code;
+    int length, code_size;
+    Object *constants;
+    int nconstants, constants_size;
+    int ncalls;			/* call sites, each with a call_cache */
+    int next_reg, nregs;
+    int overflow;
+    Object scopes;		/* names bound by each frame, innermost first */
+    int lexical;		/* compile lexical addresses */
+    int top_level;		/* free variables are module variables */
+    int lost;			/* the frames could not be followed */
+};
+
+/* local function prototypes */
+static enum compiled_form compiled_form (Object op);
+static void emit (struct compiler *c, int word);
+static int constant (struct compiler *c, Object obj);
+static int new_reg (struct compiler *c);
+static void compile_method_body (struct compiler *c, Object meth);
+static void compile_frames (struct compiler *c, Object meth);
+static Object binding_name (Object var);
+static Object bound_names (Object bindings);
+static int lexical_address (struct compiler *c, Object sym,
+			    int *depth, int *index);
+static void compile_variable (struct compiler *c, Object sym, int dst, int set);
+static void compile_statement (struct compiler *c, Object expr, int dst,
+			       int tail);
+static int compile_local_bind (struct compiler *c, Object form, int dst,
+			       int tail);
+static int compile_unbinding_begin (struct compiler *c, Object form, int dst,
+				    int tail);
+static struct binding *local_binding (int depth, int index, Object sym);
+static struct binding *global_binding (struct binding **cell, Object sym);
+static void compile_expr (struct compiler *c, Object expr, int dst, int tail);
+static void compile_value (struct compiler *c, Object value, int dst, int tail);
+static void compile_fallback (struct compiler *c, Object expr, int dst, int tail);
+static void compile_call (struct compiler *c, Object code, int dst, int tail);
+static void compile_body (struct compiler *c, Object body, Object empty,
+			  int dst, int tail);
+static int compile_syntax (struct compiler *c, Object form, int dst, int tail);
+static void patch (struct compiler *c, int at);
+#ifdef USE_CONTINUATION_STACK
+static struct continuation *push_continuation (struct bytecode *bc,
+					       Object meth);
+static struct continuation_chunk *new_continuation_chunk (void);
+static struct continuation *call_compiled (Object fun, Object meth,
+					   int argc, Object *argv,
+					   Object rest_methods,
+					   Object generic,
+					   int dst, int results);
+#endif
+
+void
+init_bytecode (void)
+{
+    int i;
+
+    for (i = 0; i < COMPILED_FORMS_SIZE; ++i) {
+	compiled_forms[i].sym = make_symbol (compiled_forms[i].name);
+    }
+}
+
+/* compile the body of meth.  returns NULL if it can't be compiled. */
+struct bytecode *
+compile_method (Object meth)
+{
+    struct compiler comp, *c = &comp;
+    struct bytecode *bc;
+    int i;
+
+    c->lexical = 1;
+    c->top_level = TOP_LEVEL_FRAME_P (METHENV (meth));
+    compile_method_body (c, meth);
+    if (c->lost) {
+	c->lexical = 0;
+	compile_method_body (c, meth);
+    }
+    if (c->overflow) {
+	return (NULL);
+    }
+    bc = MARLAIS_ALLOCATE_STRUCT (struct bytecode);
+    bc->nregs = c->nregs;
+    bc->length = c->length;
+    bc->code = c->code;
+    bc->constants = c->constants;
+    bc->cells = (struct binding **)
+	marlais_allocate_memory (c->nconstants * sizeof (struct binding *));
+    bc->calls = (struct call_cache *)
+	marlais_allocate_memory (c->ncalls * sizeof (struct call_cache));
+    for (i = 0; i < c->ncalls; ++i) {
+	init_call_cache (&bc->calls[i]);
+    }
+    return (bc);
+}
+
+static void
+compile_method_body (struct compiler *c, Object meth)
+{
+    Object body;
+    int check, reg;
+
+    c->length = c->nconstants = c->ncalls = 0;
+    c->code_size = 32;
+    c->constants_size = 8;
+    c->code = (int *) marlais_allocate_atomic (c->code_size * sizeof (int));
+    c->constants = (Object *)
+	marlais_allocate_memory (c->constants_size * sizeof (Object));
+    c->next_reg = c->nregs = 0;
+    c->overflow = c->lost = 0;
+    compile_frames (c, meth);
+
+    /* apply_method checks the value of every form in the body against
+       the declared return values; skip that when it can never fail. */
+    check = PAIRP (METHREQVALUES (meth))
+	|| METHRESTVALUES (meth) != object_class;
+
+    reg = new_reg (c);
+    body = METHBODY (meth);
+    if (EMPTYLISTP (body)) {
+	compile_value (c, unspecified_object, reg, 1);
+    }
+    while (PAIRP (body)) {
+#ifdef OPTIMIZE_TAIL_CALLS
+	if (EMPTYLISTP (CDR (body))) {
+	    if (check) {
+		emit (c, OP_NARROW_VALUES);
+	    }
+	    compile_statement (c, CAR (body), reg, 1);
+	    break;
+	}
+#endif
+	compile_statement (c, CAR (body), reg, 0);
+	if (check || EMPTYLISTP (CDR (body))) {
+	    emit (c, OP_CHECK_VALUES);
+	    emit (c, reg);
+	}
+	if (EMPTYLISTP (CDR (body))) {
+	    emit (c, OP_RETURN);
+	    emit (c, reg);
+	}
+	body = CDR (body);
+    }
+}
+
+Object
+execute_bytecode (struct bytecode *bc, Object meth)
+{
+#ifdef USE_CONTINUATION_STACK
+    struct continuation *k, *base;
+    struct call_cache *cache;
+    Object *regs;
+    Object fun, callee, rest_methods, generic;
+    Object *argv, buf[MAX_STACK_ARGS];
+    int argc, dst, results;
+#else
+    Object regs[BYTECODE_MAX_REGISTERS];
+#endif
+    Object *consts = bc->constants;
+    struct binding **cells = bc->cells;
+    int *code = bc->code;
+    int *pc = code;
+    struct binding *binding;
+    struct frame *frame;
+    Object val;
+    int i;
+
+#ifdef USE_CONTINUATION_STACK
+    /* switch to running the method of continuation k */
+#define RESUME(k)	(bc = (k)->bc, meth = (k)->meth, \
+			 consts = bc->constants, cells = bc->cells, \
+			 code = bc->code, regs = (k)->regs)
+
+    base = k = push_continuation (bc, meth);
+    regs = k->regs;
+#endif
+
+#if defined(__GNUC__)
+    static void *labels[] =
+    {
+	&&op_const, &&op_variable, &&op_set_variable, &&op_local,
+	&&op_set_local, &&op_free_variable, &&op_set_free, &&op_global,
+	&&op_set_global, &&op_push_scope,
+	&&op_enter_scope, &&op_bind, &&op_pop_scopes, &&op_eval,
+	&&op_tail_eval, &&op_call, &&op_tail_call, &&op_jump,
+	&&op_jump_false, &&op_jump_true, &&op_first_value,
+	&&op_check_values, &&op_narrow_values, &&op_return
+    };
+
+#define DISPATCH()	goto *labels[*pc++]
+#define OPCODE(label, op)	label:
+#define END_DISPATCH
+    DISPATCH ();
+#else
+#define DISPATCH()	goto dispatch
+#define OPCODE(label, op)	case op:
+#define END_DISPATCH	}
+  dispatch:
+    switch (*pc++) {
+#endif
+
+    OPCODE (op_const, OP_CONST)
+	regs[pc[0]] = consts[pc[1]];
+	pc += 2;
+	DISPATCH ();
+
+    OPCODE (op_variable, OP_VARIABLE)
+	val = symbol_value (consts[pc[1]]);
+	if (!val) {
+	    marlais_error ("unbound variable", consts[pc[1]], NULL);
+	}
+	regs[pc[0]] = val;
+	pc += 2;
+	DISPATCH ();
+
+    OPCODE (op_set_variable, OP_SET_VARIABLE)
+	val = devalue (regs[pc[0]]);
+	modify_value (consts[pc[1]], val);
+	regs[pc[0]] = val;
+	pc += 2;
+	DISPATCH ();
+
+    OPCODE (op_local, OP_LOCAL)
+	binding = local_binding (pc[1], pc[2], consts[pc[3]]);
+	if (!binding) {
+	    marlais_error ("unbound variable", consts[pc[3]], NULL);
+	}
+	regs[pc[0]] = *(binding->val);
+	pc += 4;
+	DISPATCH ();
+
+    OPCODE (op_set_local, OP_SET_LOCAL)
+	val = devalue (regs[pc[0]]);
+	modify_binding (local_binding (pc[1], pc[2], consts[pc[3]]),
+			consts[pc[3]], val);
+	regs[pc[0]] = val;
+	pc += 4;
+	DISPATCH ();
+
+    OPCODE (op_free_variable, OP_FREE_VARIABLE)
+	binding = symbol_binding_from (METHENV (meth), consts[pc[1]]);
+	if (!binding) {
+	    marlais_error ("unbound variable", consts[pc[1]], NULL);
+	}
+	regs[pc[0]] = *(binding->val);
+	pc += 2;
+	DISPATCH ();
+
+    OPCODE (op_set_free, OP_SET_FREE)
+	val = devalue (regs[pc[0]]);
+	modify_binding (symbol_binding_from (METHENV (meth), consts[pc[1]]),
+			consts[pc[1]], val);
+	regs[pc[0]] = val;
+	pc += 2;
+	DISPATCH ();
+
+    OPCODE (op_global, OP_GLOBAL)
+	binding = cells[pc[1]];
+	if (!binding) {
+	    binding = global_binding (&cells[pc[1]], consts[pc[1]]);
+	}
+	regs[pc[0]] = *(binding->val);
+	pc += 2;
+	DISPATCH ();
+
+    OPCODE (op_set_global, OP_SET_GLOBAL)
+	val = devalue (regs[pc[0]]);
+	binding = cells[pc[1]];
+	if (!binding) {
+	    binding = global_binding (&cells[pc[1]], consts[pc[1]]);
+	}
+	modify_binding (binding, consts[pc[1]], val);
+	regs[pc[0]] = val;
+	pc += 2;
+	DISPATCH ();
+
+    OPCODE (op_push_scope, OP_PUSH_SCOPE)
+	/* like local_bind_eval, the inits are evaluated outside the
+	   new frame, which is entered once they are all bound. */
+	frame = the_env;
+	push_sized_scope (consts[pc[1]], pc[2]);
+	regs[pc[0]] = (Object) the_env;
+	the_env = frame;
+	pc += 3;
+	DISPATCH ();
+
+    OPCODE (op_enter_scope, OP_ENTER_SCOPE)
+	the_env = (struct frame *) regs[pc[0]];
+	pc += 1;
+	DISPATCH ();
+
+    OPCODE (op_bind, OP_BIND)
+	bind_values (consts[pc[1]], regs[pc[2]], 0, 0,
+		     (struct frame *) regs[pc[0]]);
+	pc += 3;
+	DISPATCH ();
+
+    OPCODE (op_pop_scopes, OP_POP_SCOPES)
+	for (i = pc[0]; i > 0; --i) {
+	    pop_scope ();
+	}
+	pc += 1;
+	DISPATCH ();
+
+    OPCODE (op_eval, OP_EVAL)
+	regs[pc[0]] = eval (consts[pc[1]]);
+	pc += 2;
+	DISPATCH ();
+
+    OPCODE (op_tail_eval, OP_TAIL_EVAL)
+	val = tail_eval (consts[pc[0]]);
+#ifdef USE_CONTINUATION_STACK
+	if (k != base) {
+	    leave_method (&k->call);
+	    pop_eval_stack ();
+	    if (val != tail_call_object) {
+		goto finish;
+	    }
+	    val = tail_call_function (&fun, &argc, &argv, buf);
+	    the_env = k->call.old_env;
+	    if (val != tail_call_object) {
+		goto finish;
+	    }
+	    cache = NULL;
+	    goto tail_call;
+	}
+	continuation_top = base->caller;
+#endif
+	return (val);
+
+    OPCODE (op_call, OP_CALL)
+#ifdef USE_CONTINUATION_STACK
+	argc = pc[2];
+	argv = &regs[pc[1] + 1];
+	callee = dispatch_method (regs[pc[1]], &bc->calls[pc[3]], &argc, &argv,
+				  buf, &rest_methods, &generic);
+	if (callee && generic == regs[pc[1]] && METHACCESSOR (callee)) {
+	    regs[pc[0]] = apply_slot_accessor (callee, argv);
+	    pc += 4;
+	    DISPATCH ();
+	}
+	if (callee && METHCODE (callee)) {
+	    k->pc = pc + 4;
+	    results = result_types_depth;
+	    push_result_types ();
+	    k = call_compiled (regs[pc[1]], callee, argc, argv,
+			       rest_methods, generic, pc[0], results);
+	    RESUME (k);
+	    pc = code;
+	    DISPATCH ();
+	}
+	regs[pc[0]] = apply_argv (regs[pc[1]], argc, argv);
+#else
+	regs[pc[0]] = apply_argv (regs[pc[1]], pc[2], &regs[pc[1] + 1]);
+#endif
+	pc += 4;
+	DISPATCH ();
+
+    OPCODE (op_tail_call, OP_TAIL_CALL)
+#ifdef USE_CONTINUATION_STACK
+	if (k != base) {
+	    /* the arguments must outlive k's registers */
+	    fun = regs[pc[0]];
+	    argc = pc[1];
+	    argv = (argc <= MAX_STACK_ARGS) ? buf
+		: (Object *) marlais_allocate_memory (argc * sizeof (Object));
+	    for (i = 0; i < argc; ++i) {
+		argv[i] = regs[pc[0] + 1 + i];
+	    }
+	    cache = &bc->calls[pc[2]];
+	    leave_method (&k->call);
+	    pop_eval_stack ();
+	    goto tail_call;
+	}
+	val = tail_apply (regs[pc[0]], pc[1], &regs[pc[0] + 1]);
+	continuation_top = base->caller;
+	return (val);
+#else
+	return tail_apply (regs[pc[0]], pc[1], &regs[pc[0] + 1]);
+#endif
+
+    OPCODE (op_jump, OP_JUMP)
+	pc = code + pc[0];
+	DISPATCH ();
+
+    OPCODE (op_jump_false, OP_JUMP_FALSE)
+	pc = (regs[pc[0]] == MARLAIS_FALSE) ? code + pc[1] : pc + 2;
+	DISPATCH ();
+
+    OPCODE (op_jump_true, OP_JUMP_TRUE)
+	pc = (regs[pc[0]] != MARLAIS_FALSE) ? code + pc[1] : pc + 2;
+	DISPATCH ();
+
+    OPCODE (op_first_value, OP_FIRST_VALUE)
+	if (VALUESP (regs[pc[0]])) {
+	    regs[pc[0]] = FIRSTVAL (regs[pc[0]]);
+	}
+	pc += 1;
+	DISPATCH ();
+
+    OPCODE (op_check_values, OP_CHECK_VALUES)
+	regs[pc[0]] = construct_return_values (regs[pc[0]],
+					       METHREQVALUES (meth),
+					       METHRESTVALUES (meth));
+	pc += 1;
+	DISPATCH ();
+
+    OPCODE (op_narrow_values, OP_NARROW_VALUES)
+	narrow_result_types (meth);
+	DISPATCH ();
+
+    OPCODE (op_return, OP_RETURN)
+	val = regs[pc[0]];
+#ifdef USE_CONTINUATION_STACK
+	if (k != base) {
+	    leave_method (&k->call);
+	    pop_eval_stack ();
+	    goto finish;
+	}
+	continuation_top = base->caller;
+#endif
+	return (val);
+
+#ifdef USE_CONTINUATION_STACK
+  tail_call:
+	/* k, already left, is replaced by a call of fun to argv. */
+	callee = dispatch_method (fun, cache, &argc, &argv, buf,
+				  &rest_methods, &generic);
+	if (callee && generic == fun && METHACCESSOR (callee)) {
+	    val = apply_slot_accessor (callee, argv);
+	    goto finish;
+	}
+	if (!callee || !METHCODE (callee)) {
+	    val = apply_argv (fun, argc, argv);
+	    goto finish;
+	}
+	dst = k->dst;
+	results = k->results;
+	continuation_top = k->caller;
+	k = call_compiled (fun, callee, argc, argv,
+			   rest_methods, generic, dst, results);
+	RESUME (k);
+	pc = code;
+	DISPATCH ();
+
+  finish:
+	/* val is what k's call gives: hand it back to the caller. */
+	val = construct_return_values (val,
+				       result_types[k->results].required,
+				       result_types[k->results].rest);
+	result_types_depth = k->results;
+	dst = k->dst;
+	k = continuation_top = k->caller;
+	RESUME (k);
+	regs[dst] = val;
+	pc = k->pc;
+	DISPATCH ();
+#endif
+
+    END_DISPATCH
+}
+
+#ifdef USE_CONTINUATION_STACK
+/* a continuation for running bc's method, on top of the stack. */
+static struct continuation *
+push_continuation (struct bytecode *bc, Object meth)
+{
+    struct continuation_chunk *chunk;
+    struct continuation *k;
+    char *space;
+    int size;
+
+    size = sizeof (struct continuation) + bc->nregs * sizeof (Object);
+    if (continuation_top) {
+	chunk = continuation_top->chunk;
+	space = (char *) (continuation_top->regs
+			  + continuation_top->bc->nregs);
+    } else {
+	if (!first_continuation_chunk) {
+	    first_continuation_chunk = new_continuation_chunk ();
+	}
+	chunk = first_continuation_chunk;
+	space = (char *) (chunk + 1);
+    }
+    if (space + size > chunk->limit) {
+	if (!chunk->next) {
+	    chunk->next = new_continuation_chunk ();
+	}
+	chunk = chunk->next;
+	space = (char *) (chunk + 1);
+    }
+    k = (struct continuation *) space;
+    k->caller = continuation_top;
+    k->chunk = chunk;
+    k->bc = bc;
+    k->meth = meth;
+    k->regs = (Object *) (k + 1);
+    continuation_top = k;
+    return (k);
+}
+
+static struct continuation_chunk *
+new_continuation_chunk (void)
+{
+    struct continuation_chunk *chunk;
+
+    chunk = (struct continuation_chunk *)
+	marlais_allocate_memory (CONTINUATION_CHUNK_SIZE);
+    chunk->next = NULL;
+    chunk->limit = (char *) chunk + CONTINUATION_CHUNK_SIZE;
+    return (chunk);
+}
+
+/* begin a call of fun, which runs meth, in a new continuation.  its
+   value goes in the caller's register dst and is checked against the
+   result types at depth results. */
+static struct continuation *
+call_compiled (Object fun, Object meth, int argc, Object *argv,
+	       Object rest_methods, Object generic, int dst, int results)
+{
+    struct continuation *k;
+
+    push_eval_stack (fun);
+    k = push_continuation (METHCODE (meth), meth);
+    k->dst = dst;
+    k->results = results;
+    enter_method (&k->call, meth, argc, argv, rest_methods, generic);
+    return (k);
+}
+#endif
+
+static enum compiled_form
+compiled_form (Object op)
+{
+    int i;
+
+    for (i = 0; i < COMPILED_FORMS_SIZE; ++i) {
+	if (compiled_forms[i].sym == op) {
+	    return (compiled_forms[i].form);
+	}
+    }
+    return (NotCompiled);
+}
+
+static void
+emit (struct compiler *c, int word)
+{
+    if (c->length == c->code_size) {
+	c->code_size *= 2;
+	c->code = (int *)
+	    marlais_reallocate_memory (c->code, c->code_size * sizeof (int));
+    }
+    c->code[c->length++] = word;
+}
+
+static int
+constant (struct compiler *c, Object obj)
+{
+    int i;
+
+    for (i = 0; i < c->nconstants; ++i) {
+	if (c->constants[i] == obj) {
+	    return (i);
+	}
+    }
+    if (c->nconstants == c->constants_size) {
+	c->constants_size *= 2;
+	c->constants = (Object *)
+	    marlais_reallocate_memory (c->constants,
+				       c->constants_size * sizeof (Object));
+    }
+    c->constants[c->nconstants] = obj;
+    return (c->nconstants++);
+}
+
+static int
+new_reg (struct compiler *c)
+{
+    int reg = c->next_reg++;
+
+    if (c->next_reg > c->nregs) {
+	c->nregs = c->next_reg;
+    }
+    if (c->nregs > BYTECODE_MAX_REGISTERS) {
+	c->overflow = 1;
+	c->next_reg = 0;
+	return (0);
+    }
+    return (reg);
+}
+
+/* fill in the jump target at `at' with the current position. */
+static void
+patch (struct compiler *c, int at)
+{
+    c->code[at] = c->length;
+}
+
+/* compile expr so that its value ends up in dst, or, in tail
+   position, so that it returns from the method. */
+static void
+compile_expr (struct compiler *c, Object expr, int dst, int tail)
+{
+    if (SYMBOLP (expr)) {
+	compile_variable (c, expr, dst, 0);
+	if (tail) {
+	    emit (c, OP_RETURN);
+	    emit (c, dst);
+	}
+    } else if (self_evaluating_p (expr)) {
+	compile_value (c, expr, dst, tail);
+    } else if (CODEP (expr) && CODEKIND (expr) == ConstantCode) {
+	compile_value (c, CODEVALUE (expr), dst, tail);
+    } else if (CODEP (expr) && CODEKIND (expr) == CallCode) {
+	compile_call (c, expr, dst, tail);
+    } else if (!CODEP (expr) || CODEKIND (expr) != SyntaxCode
+	       || !compile_syntax (c, CODEFORM (expr), dst, tail)) {
+	compile_fallback (c, expr, dst, tail);
+    }
+}
+
+static void
+compile_value (struct compiler *c, Object value, int dst, int tail)
+{
+    emit (c, OP_CONST);
+    emit (c, dst);
+    emit (c, constant (c, value));
+    if (tail) {
+	emit (c, OP_RETURN);
+	emit (c, dst);
+    }
+}
+
+static void
+compile_fallback (struct compiler *c, Object expr, int dst, int tail)
+{
+#ifdef OPTIMIZE_TAIL_CALLS
+    if (tail) {
+	emit (c, OP_TAIL_EVAL);
+	emit (c, constant (c, expr));
+	return;
+    }
+#endif
+    emit (c, OP_EVAL);
+    emit (c, dst);
+    emit (c, constant (c, expr));
+    if (tail) {
+	emit (c, OP_RETURN);
+	emit (c, dst);
+    }
+}
+
+/* operator and arguments go in consecutive registers. */
+static void
+compile_call (struct compiler *c, Object code, int dst, int tail)
+{
+    Object operands;
+    int base, argc, reg, old_next;
+
+    old_next = c->next_reg;
+    base = new_reg (c);
+    compile_expr (c, CODEOPERATOR (code), base, 0);
+    argc = 0;
+    for (operands = CODEOPERANDS (code);
+	 PAIRP (operands);
+	 operands = CDR (operands)) {
+	reg = new_reg (c);
+	compile_expr (c, CAR (operands), reg, 0);
+	argc++;
+    }
+#ifdef OPTIMIZE_TAIL_CALLS
+    if (tail) {
+	emit (c, OP_TAIL_CALL);
+	emit (c, base);
+	emit (c, argc);
+	emit (c, c->ncalls++);
+	c->next_reg = old_next;
+	return;
+    }
+#endif
+    emit (c, OP_CALL);
+    emit (c, dst);
+    emit (c, base);
+    emit (c, argc);
+    emit (c, c->ncalls++);
+    if (tail) {
+	emit (c, OP_RETURN);
+	emit (c, dst);
+    }
+    c->next_reg = old_next;
+}
+
+/* a body as eval_body runs it: empty is the value of no forms. */
+static void
+compile_body (struct compiler *c, Object body, Object empty, int dst, int tail)
+{
+    if (!PAIRP (body)) {
+	compile_value (c, empty, dst, tail);
+	return;
+    }
+    while (PAIRP (CDR (body))) {
+	compile_expr (c, CAR (body), dst, 0);
+	body = CDR (body);
+    }
+    compile_expr (c, CAR (body), dst, tail);
+}
+
+/* returns 0 if the form is left for the syntax function. */
+static int
+compile_syntax (struct compiler *c, Object form, int dst, int tail)
+{
+    Object rest = CDR (form);
+    int old_next, test, jump, end;
+
+    old_next = c->next_reg;
+    switch (compiled_form (CAR (form))) {
+    case IfForm:
+	if (list_length (form) != 4) {
+	    return 0;
+	}
+	test = new_reg (c);
+	compile_expr (c, FIRST (rest), test, 0);
+	emit (c, OP_JUMP_FALSE);
+	emit (c, test);
+	jump = c->length;
+	emit (c, 0);
+	compile_expr (c, SECOND (rest), dst, tail);
+	if (!tail) {
+	    emit (c, OP_JUMP);
+	    end = c->length;
+	    emit (c, 0);
+	}
+	patch (c, jump);
+	compile_expr (c, THIRD (rest), dst, tail);
+	if (!tail) {
+	    patch (c, end);
+	}
+	break;
+    case BeginForm:
+	compile_body (c, rest, unspecified_object, dst, tail);
+	break;
+    case AndForm:
+    case OrForm:
+	if (!PAIRP (rest)) {
+	    if (compiled_form (CAR (form)) == AndForm) {
+		return 0;
+	    }
+	    compile_value (c, MARLAIS_FALSE, dst, tail);
+	    break;
+	}
+	end = -1;
+	while (PAIRP (CDR (rest))) {
+	    compile_expr (c, CAR (rest), dst, 0);
+	    emit (c, OP_FIRST_VALUE);
+	    emit (c, dst);
+	    emit (c, compiled_form (CAR (form)) == AndForm
+		  ? OP_JUMP_FALSE : OP_JUMP_TRUE);
+	    emit (c, dst);
+	    /* chain the exits through their operands, patched below */
+	    emit (c, end);
+	    end = c->length - 1;
+	    rest = CDR (rest);
+	}
+	/* and evaluates its last clause with eval, or with tail_eval */
+	compile_expr (c, CAR (rest), dst,
+		      compiled_form (CAR (form)) == OrForm && tail);
+	while (end >= 0) {
+	    jump = c->code[end];
+	    patch (c, end);
+	    end = jump;
+	}
+	if (tail) {
+	    emit (c, OP_RETURN);
+	    emit (c, dst);
+	}
+	break;
+    case UnlessForm:
+	if (!PAIRP (rest)) {
+	    return 0;
+	}
+	test = new_reg (c);
+	compile_expr (c, CAR (rest), test, 0);
+	emit (c, OP_JUMP_TRUE);
+	emit (c, test);
+	jump = c->length;
+	emit (c, 0);
+	compile_body (c, CDR (rest), MARLAIS_FALSE, dst, tail);
+	if (!tail) {
+	    emit (c, OP_JUMP);
+	    end = c->length;
+	    emit (c, 0);
+	}
+	patch (c, jump);
+	compile_value (c, MARLAIS_FALSE, dst, tail);
+	if (!tail) {
+	    patch (c, end);
+	}
+	break;
+    case WhileForm:
+    case UntilForm:
+	if (!PAIRP (rest)) {
+	    return 0;
+	}
+	test = new_reg (c);
+	end = c->length;
+	compile_expr (c, CAR (rest), test, 0);
+	emit (c, compiled_form (CAR (form)) == WhileForm
+	      ? OP_JUMP_FALSE : OP_JUMP_TRUE);
+	emit (c, test);
+	jump = c->length;
+	emit (c, 0);
+	for (rest = CDR (rest); PAIRP (rest); rest = CDR (rest)) {
+	    compile_expr (c, CAR (rest), test, 0);
+	}
+	emit (c, OP_JUMP);
+	emit (c, end);
+	patch (c, jump);
+	compile_value (c, MARLAIS_FALSE, dst, tail);
+	break;
+    case SetForm:
+	if (!PAIRP (rest) || !SYMBOLP (CAR (rest)) || !PAIRP (CDR (rest))) {
+	    return 0;
+	}
+	compile_expr (c, SECOND (rest), dst, 0);
+	compile_variable (c, CAR (rest), dst, 1);
+	if (tail) {
+	    emit (c, OP_RETURN);
+	    emit (c, dst);
+	}
+	break;
+    case LocalBindForm:
+    case LocalBindRecForm:
+	/* outside of a body the new frame can't be followed */
+	c->lost = 1;
+	return 0;
+    case UnbindingBeginForm:
+	return compile_unbinding_begin (c, form, dst, tail);
+    default:
+	return 0;
+    }
+    c->next_reg = old_next;
+    return 1;
+}
+
+/* the method's frame holds its required parameters, then its rest
+   parameter, next-method and keyword parameters; see apply_method. */
+static void
+compile_frames (struct compiler *c, Object meth)
+{
+    Object names, *tail, params;
+
+    names = make_empty_list ();
+    tail = &names;
+    for (params = METHREQPARAMS (meth); PAIRP (params); params = CDR (params)) {
+	*tail = cons (binding_name (CAR (CAR (params))), make_empty_list ());
+	tail = &CDR (*tail);
+    }
+    if (METHRESTPARAM (meth)) {
+	*tail = cons (binding_name (METHRESTPARAM (meth)), make_empty_list ());
+	tail = &CDR (*tail);
+    }
+    if (METHNEXTMETH (meth)) {
+	*tail = cons (METHNEXTMETH (meth), make_empty_list ());
+	tail = &CDR (*tail);
+    }
+    for (params = METHKEYPARAMS (meth); PAIRP (params); params = CDR (params)) {
+	*tail = cons (binding_name (SECOND (CAR (params))), make_empty_list ());
+	tail = &CDR (*tail);
+    }
+    c->scopes = cons (names, make_empty_list ());
+}
+
+/* a variable is a symbol or (symbol type). */
+static Object
+binding_name (Object var)
+{
+    return (PAIRP (var) ? CAR (var) : var);
+}
+
+/* the names bind_values binds for a list of (var ... init) in order,
+   or NULL if the list is not well formed. */
+static Object
+bound_names (Object bindings)
+{
+    Object names, *tail, vars;
+
+    names = make_empty_list ();
+    tail = &names;
+    for (; PAIRP (bindings); bindings = CDR (bindings)) {
+	if (!PAIRP (CAR (bindings)) || !PAIRP (CDR (CAR (bindings)))) {
+	    return (NULL);
+	}
+	for (vars = CAR (bindings); PAIRP (CDR (vars)); vars = CDR (vars)) {
+	    if (CAR (vars) != hash_rest_symbol) {
+		*tail = cons (binding_name (CAR (vars)), make_empty_list ());
+		tail = &CDR (*tail);
+	    }
+	}
+    }
+    return (EMPTYLISTP (bindings) ? names : NULL);
+}
+
+static int
+lexical_address (struct compiler *c, Object sym, int *depth, int *index)
+{
+    Object scopes, names;
+
+    *depth = 0;
+    for (scopes = c->scopes; PAIRP (scopes); scopes = CDR (scopes)) {
+	*index = 0;
+	for (names = CAR (scopes); PAIRP (names); names = CDR (names)) {
+	    if (CAR (names) == sym) {
+		return 1;
+	    }
+	    ++*index;
+	}
+	++*depth;
+    }
+    return 0;
+}
+
+/* load sym into dst, or store dst into sym if set. */
+static void
+compile_variable (struct compiler *c, Object sym, int dst, int set)
+{
+    int depth, index;
+
+    if (!c->lexical) {
+	emit (c, set ? OP_SET_VARIABLE : OP_VARIABLE);
+	emit (c, dst);
+    } else if (lexical_address (c, sym, &depth, &index)) {
+	emit (c, set ? OP_SET_LOCAL : OP_LOCAL);
+	emit (c, dst);
+	emit (c, depth);
+	emit (c, index);
+    } else if (c->top_level) {
+	emit (c, set ? OP_SET_GLOBAL : OP_GLOBAL);
+	emit (c, dst);
+    } else {
+	emit (c, set ? OP_SET_FREE : OP_FREE_VARIABLE);
+	emit (c, dst);
+    }
+    emit (c, constant (c, sym));
+}
+
+/* an element of a body, where a let or local method may bind
+   variables for the rest of the body. */
+static void
+compile_statement (struct compiler *c, Object expr, int dst, int tail)
+{
+    if (!CODEP (expr) || CODEKIND (expr) != SyntaxCode
+	|| !compile_local_bind (c, CODEFORM (expr), dst, tail)) {
+	compile_expr (c, expr, dst, tail);
+    }
+}
+
+static int
+compile_local_bind (struct compiler *c, Object form, int dst, int tail)
+{
+    Object names, bindings, init;
+    int rec, frame, reg, old_next;
+
+    switch (compiled_form (CAR (form))) {
+    case LocalBindForm:
+	rec = 0;
+	break;
+    case LocalBindRecForm:
+	rec = 1;
+	break;
+    default:
+	return 0;
+    }
+    if (!PAIRP (CDR (form))
+	|| !(names = bound_names (bindings = SECOND (form)))) {
+	c->lost = 1;
+	return 0;
+    }
+    old_next = c->next_reg;
+    frame = new_reg (c);
+    emit (c, OP_PUSH_SCOPE);
+    emit (c, frame);
+    emit (c, constant (c, CAR (form)));
+    emit (c, list_length (names));
+    if (rec) {
+	/* local methods are bound in the frame they can see */
+	emit (c, OP_ENTER_SCOPE);
+	emit (c, frame);
+	c->scopes = cons (names, c->scopes);
+    }
+    for (; PAIRP (bindings); bindings = CDR (bindings)) {
+	for (init = CAR (bindings); PAIRP (CDR (init)); init = CDR (init)) ;
+	reg = new_reg (c);
+	compile_expr (c, CAR (init), reg, 0);
+	emit (c, OP_BIND);
+	emit (c, frame);
+	emit (c, constant (c, CAR (bindings)));
+	emit (c, reg);
+	c->next_reg = frame + 1;
+    }
+    if (!rec) {
+	emit (c, OP_ENTER_SCOPE);
+	emit (c, frame);
+	c->scopes = cons (names, c->scopes);
+    }
+    c->next_reg = old_next;
+    compile_value (c, unspecified_object, dst, tail);
+    return 1;
+}
+
+/* a body whose lets are undone by popping count frames at the end. */
+static int
+compile_unbinding_begin (struct compiler *c, Object form, int dst, int tail)
+{
+    Object scopes, body;
+    int count, depth;
+
+    if (!PAIRP (CDR (form)) || !INTEGERP (SECOND (form))) {
+	return 0;
+    }
+    count = INTVAL (SECOND (form));
+    scopes = c->scopes;
+    body = CDR (CDR (form));
+    if (!PAIRP (body)) {
+	compile_value (c, unspecified_object, dst, tail);
+    }
+    for (; PAIRP (body); body = CDR (body)) {
+	compile_statement (c, CAR (body), dst, tail && EMPTYLISTP (CDR (body)));
+    }
+    if (!tail) {
+	emit (c, OP_POP_SCOPES);
+	emit (c, count);
+    }
+    for (depth = 0; c->scopes != scopes; c->scopes = CDR (c->scopes)) {
+	++depth;
+    }
+    if (depth != count) {
+	c->lost = 1;
+    }
+    return 1;
+}
+
+/* the binding of sym, expected at index in the frame depth frames out. */
+static struct binding *
+local_binding (int depth, int index, Object sym)
+{
+    struct frame *frame;
+    int i;
+
+    for (frame = the_env; depth > 0; --depth) {
+	frame = frame->next;
+    }
+    if (index < frame->size && frame->bindings[index]->sym == sym) {
+	return (frame->bindings[index]);
+    }
+    for (i = 0; i < frame->size; ++i) {
+	if (frame->bindings[i]->sym == sym) {
+	    return (frame->bindings[i]);
+	}
+    }
+    return (symbol_binding (sym));
+}
+
+/* find the top level binding of sym and remember it in cell. */
+static struct binding *
+global_binding (struct binding **cell, Object sym)
+{
+    struct binding *binding;
+
+    binding = symbol_binding_top_level (sym);
+    if (!binding) {
+	marlais_error ("unbound variable", sym, NULL);
+    }
+    *cell = binding;
+    return (binding);
+}
@@ -0,0 +1,30 @@
+/* bytecode.h -- see COPYRIGHT for use */
+
+#ifndef BYTECODE_H
+#define BYTECODE_H
+
+#include "common.h"
+
+/* most registers a single method body may use */
+#define BYTECODE_MAX_REGISTERS 64
+
+struct bytecode {
+    int nregs;
+    int length;
+    int *code;
+    Object *constants;
+    struct binding **cells;	/* global bindings found for constants */
+    struct call_cache *calls;	/* one for each call site */
+};
+
+#ifdef USE_CONTINUATION_STACK
+/* the innermost running compiled method, see bytecode.c */
+struct continuation;
+extern struct continuation *continuation_top;
+#endif
+
+void init_bytecode (void);
+struct bytecode *compile_method (Object meth);
+Object execute_bytecode (struct bytecode *bc, Object meth);
+
+#endif
@@ -53,6 +53,8 @@ static Object string_size_setter (Object size, Object string);
 static Object string_append2 (Object str1, Object str2);
 static Object string_lessthan (Object str1, Object str2);
 static Object string_equal (Object str1, Object str2);
+static unsigned int fold_word (unsigned int k);
+static unsigned int hash_bytes (const char *bytes, int size, int fold);
 
 static struct primitive string_prims[] =
 {
@@ -80,6 +82,7 @@ marlais_make_bytestring (char *str)
     Object obj = marlais_allocate_object (ByteString, sizeof (struct byte_string));
 
     BYTESTRSIZE (obj) = strlen (str);
+    BYTESTRHASH (obj) = 0;
     BYTESTRVAL (obj) = marlais_allocate_strdup (str);
     return (obj);
 }
@@ -107,6 +110,7 @@ marlais_make_bytestring_entry (Object args)
   res = marlais_allocate_object (ByteString, sizeof (struct byte_string));
 
   BYTESTRSIZE (res) = size;
+  BYTESTRHASH (res) = 0;
   BYTESTRVAL (res) = MARLAIS_ALLOCATE_STRING (size + 1);
   for (i = 0; i < size; ++i) {
     BYTESTRVAL (res)[i] = fill;
@@ -116,6 +120,120 @@ marlais_make_bytestring_entry (Object args)
   return (res);
 }
 
+#define HASH_C1 0xcc9e2d51U
+#define HASH_C2 0x1b873593U
+#define HASH_ROTL(x, r) (((x) << (r)) | ((x) >> (32 - (r))))
+
+/* lower-case the ASCII letters among the four bytes of k at once. */
+static unsigned int
+fold_word (unsigned int k)
+{
+  unsigned int low, above_z, from_a, upper;
+
+  low = k & 0x7f7f7f7fU;
+  above_z = low + 0x25252525U;	/* high bit set above 'Z' */
+  from_a = low + 0x3f3f3f3fU;	/* high bit set from 'A' */
+  upper = ~k & (from_a ^ above_z) & 0x80808080U;
+  return (k | (upper >> 2));
+}
+
+#define FOLD(c) ((c) >= 'A' && (c) <= 'Z' ? (c) - 'A' + 'a' : (c))
+
+/* MurmurHash3 (x86, 32 bit), a word at a time, of the bytes or of
+   their case-folded form. */
+static unsigned int
+hash_bytes (const char *bytes, int size, int fold)
+{
+  const unsigned char *tail;
+  unsigned int h, k;
+  int i;
+
+  h = 0x9747b28cU;
+  for (i = 0; i + 4 <= size; i += 4) {
+    memcpy (&k, bytes + i, 4);
+    if (fold) {
+      k = fold_word (k);
+    }
+    k *= HASH_C1;
+    k = HASH_ROTL (k, 15);
+    k *= HASH_C2;
+    h ^= k;
+    h = HASH_ROTL (h, 13);
+    h = h * 5 + 0xe6546b64U;
+  }
+  tail = (const unsigned char *) bytes + i;
+  k = 0;
+  switch (size & 3) {
+  case 3:
+    k ^= (fold ? FOLD (tail[2]) : tail[2]) << 16;
+    /* fall through */
+  case 2:
+    k ^= (fold ? FOLD (tail[1]) : tail[1]) << 8;
+    /* fall through */
+  case 1:
+    k ^= (fold ? FOLD (tail[0]) : tail[0]);
+    k *= HASH_C1;
+    k = HASH_ROTL (k, 15);
+    k *= HASH_C2;
+    h ^= k;
+  }
+  h ^= (unsigned int) size;
+  h ^= h >> 16;
+  h *= 0x85ebca6bU;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35U;
+  h ^= h >> 16;
+  return (h ? h : 1);
+}
+
+unsigned int
+marlais_hash_bytes (const char *bytes, int size)
+{
+  return (hash_bytes (bytes, size, 0));
+}
+
+unsigned int
+marlais_hash_bytes_folded (const char *bytes, int size)
+{
+  return (hash_bytes (bytes, size, 1));
+}
+
+/* are the bytes the same ignoring ASCII case?  folds as
+   marlais_hash_bytes_folded does. */
+int
+marlais_bytes_equal_folded (const char *bytes1, const char *bytes2, int size)
+{
+  unsigned int k1, k2;
+  int i;
+
+  if (memcmp (bytes1, bytes2, size) == 0) {
+    return (1);
+  }
+  for (i = 0; i + 4 <= size; i += 4) {
+    memcpy (&k1, bytes1 + i, 4);
+    memcpy (&k2, bytes2 + i, 4);
+    if (fold_word (k1) != fold_word (k2)) {
+      return (0);
+    }
+  }
+  for (; i < size; ++i) {
+    if (FOLD ((unsigned char) bytes1[i]) != FOLD ((unsigned char) bytes2[i])) {
+      return (0);
+    }
+  }
+  return (1);
+}
+
+unsigned int
+marlais_bytestring_hash (Object string)
+{
+  if (!BYTESTRHASH (string)) {
+    BYTESTRHASH (string) = marlais_hash_bytes (BYTESTRVAL (string),
+					       BYTESTRSIZE (string));
+  }
+  return (BYTESTRHASH (string));
+}
+
 /* Static functions */
 
 static Object
@@ -144,6 +262,7 @@ string_element_setter (Object string, Object index, Object val)
 	marlais_error ("element-setter: argument out of range", string, index, NULL);
     }
     BYTESTRVAL (string)[i] = CHARVAL (val);
+    BYTESTRHASH (string) = 0;
     return (unspecified_object);
 }
 
@@ -162,6 +281,7 @@ string_size_setter (Object size, Object string)
 	marlais_error ("size-setter: new size out of range", new_size, string, NULL);
     }
     BYTESTRSIZE (string) = new_size;
+    BYTESTRHASH (string) = 0;
     BYTESTRVAL (string)[new_size] = '\0';
     return size;
 }
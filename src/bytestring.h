@@ -41,5 +41,14 @@ extern void marlais_register_bytestring (void);
 extern Object marlais_make_bytestring (char *str);
 /* Entrypoint for make(<bytestring>) */
 extern Object marlais_make_bytestring_entry (Object args);
+/* Hash size bytes; never 0 */
+extern unsigned int marlais_hash_bytes (const char *bytes, int size);
+/* Hash size bytes ignoring ASCII case; never 0 */
+extern unsigned int marlais_hash_bytes_folded (const char *bytes, int size);
+/* Compare size bytes ignoring ASCII case, as the folded hash does */
+extern int marlais_bytes_equal_folded (const char *bytes1, const char *bytes2,
+				       int size);
+/* Hash of a <bytestring>, cached until it is modified */
+extern unsigned int marlais_bytestring_hash (Object string);
 
 #endif
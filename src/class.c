@@ -30,6 +30,13 @@ extern struct binding *symbol_binding (Object sym);
 int last_class_index = 0;
 static Object class_slots_class;
 
+/* the class of every object of a type, save an instance's */
+static Object type_classes[ObjectTypeCount];
+
+/* a make's init keyword values are gathered on the C stack when the
+   class has at most SUPPLIED_BUF_SIZE instance slots. */
+#define SUPPLIED_BUF_SIZE 32
+
 /* primitives */
 static Object make_limited_int_type (Object args);
 static Object class_precedence_list (Object class);
@@ -61,6 +68,7 @@ static void append_slot_descriptors (Object sd_list,
 static void append_one_slot_descriptor (Object sd,
 					Object **new_sd_list_insert_ptr,
 					Object *sg_names_ptr);
+static void init_type_classes (void);
 static void make_getters_setters (Object class, Object slots);
 static Object make_getter_method (Object getter_name,
 				  Object class,
@@ -68,13 +76,18 @@ static Object make_getter_method (Object getter_name,
 static Object make_setter_method (Object slot,
 				  Object class,
 				  int slot_num);
-Object initialize_slots (Object descriptors, Object initializers);
-static Object pair_list_reverse (Object lst);
-static Object replace_slotd_init (Object init_slotds, Object keyword,
-				  Object init);
+static Object make_accessor_method (Object generic, Object params,
+				    Object body, int kind,
+				    Object allocation, int slot_num);
+static Object make_slot_holder (Object slotds);
+static struct instance_layout *class_layout (Object class);
+static int layout_keyword_slot (struct instance_layout *layout,
+				Object keyword);
+static int default_initialize_p (Object class, Object initialize_fun);
 static void initialize_slotds (Object class);
 static void eval_slotds (Object slotds);
 
+static void set_class_ancestors (Object class);
 static Object merge_sorted_precedence_lists (Object class, Object supers);
 static Object merge_class_lists (Object left, Object right);
 
@@ -87,6 +100,51 @@ init_class_prims (void)
   init_prims (num, class_prims);
 }
 
+static void
+init_type_classes (void)
+{
+  type_classes[Integer] = small_integer_class;
+  type_classes[BigInteger] = big_integer_class;
+  type_classes[True] = boolean_class;
+  type_classes[False] = boolean_class;
+  type_classes[Ratio] = ratio_class;
+  type_classes[SingleFloat] = single_float_class;
+  type_classes[DoubleFloat] = double_float_class;
+  type_classes[EmptyList] = empty_list_class;
+  type_classes[Pair] = pair_class;
+  type_classes[ByteString] = byte_string_class;
+  type_classes[SimpleObjectVector] = simple_object_vector_class;
+  type_classes[ObjectTable] = object_table_class;
+  type_classes[WeakKeyTable] = weak_key_table_class;
+  type_classes[WeakValueTable] = weak_value_table_class;
+  type_classes[Deque] = deque_class;
+  type_classes[Array] = array_class;
+  type_classes[Condition] = condition_class;
+  type_classes[Symbol] = symbol_class;
+  type_classes[Keyword] = keyword_class;
+  type_classes[Character] = character_class;
+  type_classes[NextMethod] = method_class;
+  type_classes[Class] = class_class;
+
+  /* need to check the following two cases */
+  type_classes[LimitedIntType] = type_class;
+  type_classes[UnionType] = type_class;
+
+  type_classes[Primitive] = primitive_class;
+  type_classes[GenericFunction] = generic_function_class;
+  type_classes[Method] = method_class;
+  type_classes[Exit] = exit_function_class;
+  type_classes[Unwind] = unwind_protect_function_class;
+  type_classes[Unspecified] = object_class;
+  type_classes[EndOfFile] = object_class;
+  type_classes[DequeEntry] = deque_entry_class;
+  type_classes[Singleton] = singleton_class;
+  type_classes[ObjectHandle] = object_handle_class;
+  type_classes[ForeignPtr] = foreign_pointer_class;	/* <pcb> */
+  type_classes[Code] = object_class;
+  type_classes[UninitializedSlotValue] = object_class;
+}
+
 void
 init_class_hierarchy (void)
 {
@@ -145,6 +203,10 @@ init_class_hierarchy (void)
 
   object_table_class =
     make_builtin_class ("<object-table>", table_class);
+  weak_key_table_class =
+    make_builtin_class ("<weak-key-table>", object_table_class);
+  weak_value_table_class =
+    make_builtin_class ("<weak-value-table>", object_table_class);
 
   deque_class =
     make_builtin_class ("<deque>",
@@ -211,7 +273,6 @@ init_class_hierarchy (void)
   singleton_class = make_builtin_class ("<singleton>", type_class);
   class_class = make_builtin_class ("<class>", type_class);
 
-  table_entry_class = make_builtin_class ("<table-entry>", object_class);
   deque_entry_class = make_builtin_class ("<deque-entry>", object_class);
 
   class_slots_class =
@@ -223,6 +284,8 @@ init_class_hierarchy (void)
   foreign_pointer_class =
     make_builtin_class ("<foreign-pointer>", object_class);	/* <pcb> */
 
+  init_type_classes ();
+
   seal (integer_class);
   seal (ratio_class);
   seal (rational_class);
@@ -300,6 +363,35 @@ make_builtin_class (char *name, Object supers)
   return make_class (obj, supers, make_empty_list (), MARLAIS_FALSE, NULL);
 }
 
+/* the ancestors of class are its supers' and itself, see
+   CLASS_SUBTYPE_P.  supers are made first, so have lower indices. */
+static void
+set_class_ancestors (Object class)
+{
+  Object supers, super;
+  unsigned long *bits;
+  int words, index, i;
+
+  index = CLASSINDEX (class);
+  words = index / ANCESTOR_BITS + 1;
+  bits = (unsigned long *)
+    marlais_allocate_atomic (words * sizeof (unsigned long));
+  for (i = 0; i < words; ++i) {
+    bits[i] = 0;
+  }
+  for (supers = CLASSSUPERS (class); PAIRP (supers); supers = CDR (supers)) {
+    super = CAR (supers);
+    if (CLASSP (super)) {
+      for (i = 0; i < CLASSANCESTORWORDS (super); ++i) {
+	bits[i] |= CLASSANCESTORS (super)[i];
+      }
+    }
+  }
+  bits[index / ANCESTOR_BITS] |= 1UL << (index % ANCESTOR_BITS);
+  CLASSANCESTORS (class) = bits;
+  CLASSANCESTORWORDS (class) = words;
+}
+
 Object
 make_class (Object obj,
 	    Object supers,
@@ -318,6 +410,7 @@ make_class (Object obj,
   Object *vi_tmp_ptr;
 
   CLASSINDEX (obj) = NEWCLASSINDEX;
+  ++dispatch_epoch;		/* call sites dispatch afresh */
   CLASSENV (obj) = the_env;
   if(abstract_p == MARLAIS_FALSE) CLASSPROPS (obj) |= CLASSINSTANTIABLE;
 
@@ -328,6 +421,7 @@ make_class (Object obj,
   } else {
     CLASSSUPERS (obj) = supers;
   }
+  set_class_ancestors (obj);
   CLASSSORTEDPRECS (obj) =
     merge_sorted_precedence_lists (obj, CLASSSUPERS (obj));
   CLASSNUMPRECS (obj) = list_length (CLASSSORTEDPRECS (obj));
@@ -408,18 +502,13 @@ make_class (Object obj,
     //marlais_warning ("Making class name", CLASSNAME(obj), NULL);
   }
   /* initialize class and each-subclass slot objects */
-  CLASSCSLOTS (obj) = marlais_allocate_object (Instance, sizeof (struct instance));
-
-  INSTCLASS (CLASSCSLOTS (obj)) = class_slots_class;
 
   /*
    * Note - CLASSCSLOTDS must precede CLASSESSLOTDS for
    * print_class_slot_values (print.c) to work correctly.
    */
-  INSTSLOTS (CLASSCSLOTS (obj)) =
-    (Object *) (VALUESELS (initialize_slots (append (CLASSCSLOTDS (obj),
-						     CLASSESSLOTDS (obj)),
-					     make_empty_list ()))[0]);
+  CLASSCSLOTS (obj) = make_slot_holder (append (CLASSCSLOTDS (obj),
+						CLASSESSLOTDS (obj)));
 
   return (obj);
 }
@@ -523,152 +612,27 @@ make_class_driver (Object args)
   return make_class (obj, supers_obj, slots_obj, abstract_obj, debug_obj);
 }
 
-/*
- * initialize_slots (slot_descriptors, initializers)
- *
- * Given
- *  i) a list of slot descriptors for a particular object class, and
- *  ii) a keyword-value association list of initializers
- *
- * Return a 2 element value object with elements
- *  i) a newly initialized vector of bindings representing the appropriately
- *     initialized slots, and
- *  ii) a keyword-value association list of initializers for the object
- *      including pairs for keyword initializable slots with init-values
- *      that were not listed in initializers
- */
-Object
-initialize_slots (Object slot_descriptors, Object initializers)
-{
-  int i;
-  Object slotd, init_slotds, tmp_slotds;
-  Object *slots;
-  Object default_initializers, initializer, *def_ptr;
-  Object extra_initializers = make_empty_list ();
-  Object extra;
-
-  /* create defaulted initialization arguments */
-
-  /* Create a copy (init_slotds) of the slot descriptors for this object
-   * and fill in the init values with the appropriate values as
-   * specified by keywords.
-   */
-
-  /* Note that we reverse the initializers list of keyword-value pairs
-   * so they get the right binding if there are duplicates.
-   */
-  initializers = pair_list_reverse (initializers);
-
-  if (PAIRP (initializers)) {
-    init_slotds = copy_list (slot_descriptors);
-    while (!EMPTYLISTP (initializers)) {
-      initializer = CAR (initializers);
-      if (KEYWORDP (initializer) && !EMPTYLISTP (CDR (initializers))) {
-	extra = replace_slotd_init (init_slotds,
-				    initializer,
-				    SECOND (initializers));
-	if (extra != NULL) {
-	  extra_initializers = append (extra, extra_initializers);
-	}
-      } else {
-	/* Should check for class or subclass initializer and
-	 * take appropriate action.  Perhaps memoize the init
-	 * and perform below.
-	 */
-	marlais_error ("Bad slot initializers", initializer, NULL);
-      }
-      initializers = CDR (CDR (initializers));
-    }
-  } else {
-    init_slotds = copy_list (slot_descriptors);
-  }
-
-  default_initializers = make_empty_list ();
-  def_ptr = &default_initializers;
-
-  /*
-   * Turn the list of modified slot descriptors (init_slotds)
-   * into the corresponding key-value association list (default_initializers)
-   * that may be passed to initialize.
-   */
-  for (tmp_slotds = init_slotds;
-       !EMPTYLISTP (tmp_slotds);
-       tmp_slotds = CDR (tmp_slotds)) {
-    slotd = CAR (tmp_slotds);
-    if (SLOTDINITKEYWORD (slotd)) {
-      if (SLOTDINIT (slotd) != uninit_slot_object) {
-	*def_ptr = listem (SLOTDINITKEYWORD (slotd),
-			   SLOTDINIT (slotd),
-			   NULL);
-	def_ptr = &CDR (CDR (*def_ptr));
-      } else if (SLOTDKEYREQ (slotd)) {
-	marlais_error ("Required keyword not specified",
-	       SLOTDINITKEYWORD (slotd), NULL);
-      }
-    }
-  }
-
-  /*
-   * Create a vector of slot values (slots)
-   * from the list of modified slot descriptors (init_slotds)
-   */
-  slots = (Object *) marlais_allocate_memory (list_length (init_slotds) *
-				      sizeof (Object));
-
-  tmp_slotds = init_slotds;
-  for (i = 0; PAIRP (tmp_slotds); tmp_slotds = CDR (tmp_slotds), i++) {
-    slotd = CAR (tmp_slotds);
-    slots[i] = listem (slot_init_value (slotd), SLOTDSLOTTYPE (slotd), NULL);
-  }
-  return construct_values (2, slots, append (default_initializers,
-					     extra_initializers));
-}
-
+/* the instance holding the values of class and each-subclass slots
+   slotds, each set to its initial value. */
 static Object
-replace_slotd_init (Object init_slotds, Object keyword, Object init)
+make_slot_holder (Object slotds)
 {
-  Object slotd;
-  Object new_slotd;
-
-  while (PAIRP (init_slotds)) {
-    slotd = CAR (init_slotds);
-
-    if (SLOTDINITKEYWORD (slotd) == keyword) {
-      new_slotd = marlais_allocate_object (SlotDescriptor, sizeof (struct slot_descriptor));
-
-      CAR (init_slotds) = new_slotd;
-      SLOTDPROPS (new_slotd) = SLOTDPROPS (slotd) & ~SLOTDINITFUNCTIONMASK;
-      SLOTDGETTER (new_slotd) = SLOTDGETTER (slotd);
-      SLOTDSETTER (new_slotd) = SLOTDSETTER (slotd);
-      SLOTDSLOTTYPE (new_slotd) = SLOTDSLOTTYPE (slotd);
-      SLOTDINITKEYWORD (new_slotd) = SLOTDINITKEYWORD (slotd);
-      SLOTDALLOCATION (new_slotd) = SLOTDALLOCATION (slotd);
-      SLOTDDYNAMISM (new_slotd) = SLOTDDYNAMISM (slotd);
+  Object holder, slotd;
+  int i;
 
-      SLOTDINIT (new_slotd) = init;
-      return NULL;
+  holder = marlais_allocate_object (Instance,
+				    INSTANCE_SIZE (list_length (slotds)));
+  INSTCLASS (holder) = class_slots_class;
+  for (i = 0; PAIRP (slotds); ++i, slotds = CDR (slotds)) {
+    slotd = CAR (slotds);
+    if (SLOTDINITKEYWORD (slotd) && SLOTDINIT (slotd) == uninit_slot_object
+	&& SLOTDKEYREQ (slotd)) {
+      marlais_error ("Required keyword not specified",
+	     SLOTDINITKEYWORD (slotd), NULL);
     }
-    init_slotds = CDR (init_slotds);
+    INSTSLOTS (holder)[i] = slot_init_value (slotd);
   }
-/*
- *  If you get to here, the keyword did not match a slot init-keyword
- *  Return the list containing the keyword and initial value to
- *  signify this fact.
- */
-  return listem (keyword, init, NULL);
-}
-
-static Object
-pair_list_reverse (Object lst)
-{
-  Object result;
-
-  result = make_empty_list ();
-  while (PAIRP (lst) && PAIRP (CDR (lst))) {
-    result = cons (CAR (lst), cons (SECOND (lst), result));
-    lst = CDR (CDR (lst));
-  }
-  return result;
+  return (holder);
 }
 
 /*
@@ -733,28 +697,190 @@ make_union_type (Object typelist)
 }
 
 /*
- * make_instance (class, initializers)
+ * make_instance (class, initializers, want_initializers)
  *
- * Destructively modifies second parameter to include default initializations.
+ * Destructively modifies second parameter to include default
+ * initializations, if want_initializers.
  *
  */
 Object
-make_instance (Object class, Object *initializers)
+make_instance (Object class, Object *initializers, int want_initializers)
 {
-  Object obj, ret;
-
-  obj = marlais_allocate_object (Instance, sizeof (struct instance));
+  struct instance_layout *layout;
+  Object obj, inits, slotd, val;
+  Object *supplied, supplied_buf[SUPPLIED_BUF_SIZE];
+  Object extra, *extra_ptr, defaults, *def_ptr;
+  int i;
 
+  layout = class_layout (class);
+  obj = marlais_allocate_object (Instance, INSTANCE_SIZE (layout->count));
   INSTCLASS (obj) = class;
-  initialize_slotds (class);
-  ret = initialize_slots (append (CLASSINSLOTDS (class), CLASSSLOTDS (class)),
-			  *initializers);
-  INSTSLOTS (obj) = (Object *) (VALUESELS (ret)[0]);
-  *initializers = VALUESELS (ret)[1];
+
+  /* note the first value given for each slot's init keyword and
+     keep the other keyword-value pairs as they are */
+  if (layout->count <= SUPPLIED_BUF_SIZE) {
+    supplied = supplied_buf;
+  } else {
+    supplied = (Object *) marlais_allocate_memory (layout->count
+						   * sizeof (Object));
+  }
+  memset (supplied, 0, layout->count * sizeof (Object));
+  extra = make_empty_list ();
+  extra_ptr = &extra;
+  for (inits = *initializers; PAIRP (inits); inits = CDR (CDR (inits))) {
+    if (!KEYWORDP (CAR (inits)) || EMPTYLISTP (CDR (inits))) {
+      marlais_error ("Bad slot initializers", CAR (inits), NULL);
+    }
+    i = layout_keyword_slot (layout, CAR (inits));
+    if (i < 0) {
+      if (want_initializers) {
+	*extra_ptr = listem (CAR (inits), SECOND (inits), NULL);
+	extra_ptr = &CDR (CDR (*extra_ptr));
+      }
+    } else if (!supplied[i]) {
+      supplied[i] = SECOND (inits);
+    }
+  }
+
+  /* the keyword-value pairs for initialize start with one for each
+     keyword initializable slot that gets a value */
+  defaults = make_empty_list ();
+  def_ptr = &defaults;
+  for (i = 0; i < layout->count; ++i) {
+    slotd = layout->slotds[i];
+    if (SLOTDINITKEYWORD (slotd)) {
+      val = supplied[i] ? supplied[i] : SLOTDINIT (slotd);
+      if (val != uninit_slot_object) {
+	if (want_initializers) {
+	  *def_ptr = listem (SLOTDINITKEYWORD (slotd), val, NULL);
+	  def_ptr = &CDR (CDR (*def_ptr));
+	}
+      } else if (SLOTDKEYREQ (slotd)) {
+	marlais_error ("Required keyword not specified",
+	       SLOTDINITKEYWORD (slotd), NULL);
+      }
+    }
+  }
+  if (want_initializers) {
+    *def_ptr = extra;
+    *initializers = defaults;
+  }
+
+  for (i = 0; i < layout->count; ++i) {
+    INSTSLOTS (obj)[i] = supplied[i] ? supplied[i]
+      : slot_init_value (layout->slotds[i]);
+  }
 
   return (obj);
 }
 
+/* class's instance layout, made the first time it is needed. */
+static struct instance_layout *
+class_layout (Object class)
+{
+  struct instance_layout *layout;
+  Object slotds, keyword;
+  int i, j;
+
+  if (CLASSLAYOUT (class)) {
+    return (CLASSLAYOUT (class));
+  }
+  initialize_slotds (class);
+  slotds = append (CLASSINSLOTDS (class), CLASSSLOTDS (class));
+  layout = MARLAIS_ALLOCATE_STRUCT (struct instance_layout);
+  layout->count = list_length (slotds);
+  layout->slotds = (Object *)
+    marlais_allocate_memory (layout->count * sizeof (Object));
+  layout->keywords = (Object *)
+    marlais_allocate_memory (layout->count * sizeof (Object));
+  layout->keyword_slots = (int *)
+    marlais_allocate_memory (layout->count * sizeof (int));
+  layout->nkeywords = 0;
+  for (i = 0; PAIRP (slotds); ++i, slotds = CDR (slotds)) {
+    layout->slotds[i] = CAR (slotds);
+    keyword = SLOTDINITKEYWORD (CAR (slotds));
+    if (!keyword || layout_keyword_slot (layout, keyword) >= 0) {
+      continue;
+    }
+    /* insertion sort on keyword address */
+    for (j = layout->nkeywords; j > 0; --j) {
+      if ((unsigned long) layout->keywords[j - 1] < (unsigned long) keyword) {
+	break;
+      }
+      layout->keywords[j] = layout->keywords[j - 1];
+      layout->keyword_slots[j] = layout->keyword_slots[j - 1];
+    }
+    layout->keywords[j] = keyword;
+    layout->keyword_slots[j] = i;
+    layout->nkeywords++;
+  }
+  layout->init_fun = NULL;
+  CLASSLAYOUT (class) = layout;
+  return (layout);
+}
+
+/* the slot keyword initializes, or -1. */
+static int
+layout_keyword_slot (struct instance_layout *layout, Object keyword)
+{
+  int lo, hi, mid;
+
+  lo = 0;
+  hi = layout->nkeywords - 1;
+  while (lo <= hi) {
+    mid = (lo + hi) / 2;
+    if (layout->keywords[mid] == keyword) {
+      return (layout->keyword_slots[mid]);
+    } else if ((unsigned long) layout->keywords[mid]
+	       < (unsigned long) keyword) {
+      lo = mid + 1;
+    } else {
+      hi = mid - 1;
+    }
+  }
+  return (-1);
+}
+
+/* would applying initialize_fun to a new instance of class do
+   nothing?  true when every method that can apply has an empty body
+   and takes any keywords; the answer is kept until methods or
+   classes change. */
+static int
+default_initialize_p (Object class, Object initialize_fun)
+{
+  struct instance_layout *layout;
+  Object methods, meth, spec;
+
+  layout = class_layout (class);
+  if (layout->init_fun == initialize_fun
+      && layout->init_epoch == dispatch_epoch) {
+    return (layout->default_init);
+  }
+  layout->init_fun = initialize_fun;
+  layout->init_epoch = dispatch_epoch;
+  layout->default_init = GFUNP (initialize_fun);
+  if (!layout->default_init) {
+    return (0);
+  }
+  for (methods = GFMETHODS (initialize_fun);
+       PAIRP (methods);
+       methods = CDR (methods)) {
+    meth = CAR (methods);
+    if (EMPTYLISTP (METHBODY (meth)) && !METHKEYINDEX (meth)
+	&& METHALLKEYS (meth)) {
+      continue;
+    }
+    /* a new instance can't be any method's singleton */
+    spec = METHSIG (meth)->specializers[0];
+    if (SINGLETONP (spec) || (CLASSP (spec) && !subtype (class, spec))) {
+      continue;
+    }
+    layout->default_init = 0;
+    break;
+  }
+  return (layout->default_init);
+}
+
 static void
 initialize_slotds (Object class)
 {
@@ -805,10 +931,8 @@ eval_slotds (Object slotds)
     slotd = CAR (slotds);
     SLOTDSLOTTYPE (slotd) = eval (SLOTDSLOTTYPE (slotd));
     if (SLOTDDEFERREDTYPE (slotd)) {
-      SLOTDSLOTTYPE (slotd) = apply_method (eval (SLOTDSLOTTYPE (slotd)),
-					    make_empty_list (),
-					    make_empty_list (),
-					    NULL);
+      SLOTDSLOTTYPE (slotd) = apply (eval (SLOTDSLOTTYPE (slotd)),
+				     make_empty_list ());
     }
     slotds = CDR (slotds);
   }
@@ -834,6 +958,7 @@ make (Object class, Object rest)
     marlais_error ("make: class uninstantiable", class, NULL);
     return MARLAIS_FALSE;
   }
+  initialize_fun = symbol_value (initialize_symbol);
   /* special case the builtin classes */
   if (class == pair_class) {
     ret = make_pair_driver (rest);
@@ -849,7 +974,11 @@ make (Object class, Object rest)
   } else if (class == generic_function_class) {
     ret = make_generic_function_driver (rest);
   } else if ((class == table_class) || (class == object_table_class)) {
-    ret = make_table_driver (rest);
+    ret = make_table_driver (ObjectTable, rest);
+  } else if (class == weak_key_table_class) {
+    ret = make_table_driver (WeakKeyTable, rest);
+  } else if (class == weak_value_table_class) {
+    ret = make_table_driver (WeakValueTable, rest);
   } else if (class == deque_class) {
     ret = marlais_make_deque_entry (rest);
   } else if (class == array_class) {
@@ -857,9 +986,11 @@ make (Object class, Object rest)
   } else if (class == class_class) {
     ret = make_class_driver (rest);
   } else {
-    ret = make_instance (class, &rest);
+    if (initialize_fun && default_initialize_p (class, initialize_fun)) {
+      return make_instance (class, &rest, 0);
+    }
+    ret = make_instance (class, &rest, 1);
   }
-  initialize_fun = symbol_value (initialize_symbol);
   if (initialize_fun) {
     apply (initialize_fun, cons (ret, rest));
   } else {
@@ -925,6 +1056,8 @@ subtype (Object type1, Object type2)
 
   if (type1 == type2) {
     return 1;
+  } else if (CLASSP (type1) && CLASSP (type2)) {
+    return CLASS_SUBTYPE_P (type1, type2);
   } else if (SINGLETONP (type1)) {
     return (instance (SINGLEVAL (type1), type2));
   } else if (LIMINTP (type1)) {
@@ -995,85 +1128,21 @@ direct_subclasses (Object class)
 Object
 objectclass (Object obj)
 {
-  switch (object_type (obj)) {
-  case Integer:
+  Object class;
+
+#ifdef SMALL_OBJECTS
+  if (INTEGERP (obj)) {
     return (small_integer_class);
-  case BigInteger:
-    return (big_integer_class);
-  case True:
-  case False:
-    return (boolean_class);
-    break;
-  case Ratio:
-    return (ratio_class);
-  case SingleFloat:
-    return (single_float_class);
-  case DoubleFloat:
-    return (double_float_class);
-  case EmptyList:
-    return (empty_list_class);
-  case Pair:
-    return (pair_class);
-  case ByteString:
-    return (byte_string_class);
-  case SimpleObjectVector:
-    return (simple_object_vector_class);
-  case ObjectTable:
-    return (object_table_class);
-  case Deque:
-    return (deque_class);
-  case Array:
-    return (array_class);
-  case Condition:
-    return (condition_class);
-  case Symbol:
-    return (symbol_class);
-  case Keyword:
-    return (keyword_class);
-  case Character:
-    return (character_class);
-  case NextMethod:
-    return (method_class);
-  case Class:
-    return (class_class);
-  case Instance:
+  }
+#endif
+  if (INSTANCEP (obj)) {
     return (INSTCLASS (obj));
-
-    /* need to check the following two cases */
-  case LimitedIntType:
-    return (type_class);
-  case UnionType:
-    return (type_class);
-
-  case Primitive:
-    return (primitive_class);
-  case GenericFunction:
-    return (generic_function_class);
-  case Method:
-    return (method_class);
-  case Exit:
-    return (exit_function_class);
-  case Unwind:
-    return (unwind_protect_function_class);
-  case Unspecified:
-    return (object_class);
-  case EndOfFile:
-    return (object_class);
-  case TableEntry:
-    return (table_entry_class);
-  case DequeEntry:
-    return (deque_entry_class);
-  case Singleton:
-    return (singleton_class);
-  case ObjectHandle:
-    return (object_handle_class);
-  case ForeignPtr:
-    return (foreign_pointer_class);		/* <pcb> */
-  case UninitializedSlotValue:
-    return (object_class);
-  default:
+  }
+  class = type_classes[object_type (obj)];
+  if (!class) {
     return marlais_error ("object-class: don't know class of object", obj, NULL);
   }
+  return (class);
 }
 
 Object
@@ -1228,15 +1297,16 @@ make_getter_method (Object slot, Object class, int slot_num)
   }
   if (allocation == constant_symbol) {
     body = cons (SLOTDINIT (slot), make_empty_list ());
-  } else {
-    body = listem (listem (slot_val_sym,
-			   slot_location,
-			   marlais_make_integer (slot_num),
-			   NULL),
-		   NULL);
+    return (make_method (GFNAME (SLOTDGETTER (slot)),
+			 params, body, the_env, 1));
   }
-  return (make_method (GFNAME (SLOTDGETTER (slot)),
-		       params, body, the_env, 1));
+  body = listem (listem (slot_val_sym,
+			 slot_location,
+			 marlais_make_integer (slot_num),
+			 NULL),
+		 NULL);
+  return (make_accessor_method (SLOTDGETTER (slot), params, body,
+				METHGETTERMASK, allocation, slot_num));
 }
 
 /*
@@ -1293,8 +1363,27 @@ make_setter_method (Object slot, Object class, int slot_num)
 			 val_sym,
 			 NULL),
 		 NULL);
-  return (make_method (GFNAME (SLOTDSETTER (slot)),
-		       params, body, the_env, 1));
+  return (make_accessor_method (SLOTDSETTER (slot), params, body,
+				METHSETTERMASK, allocation, slot_num));
+}
+
+/* add to generic a method whose body is the slot access described by
+   kind, allocation and slot_num, so that dispatch can do the access
+   itself with apply_slot_accessor. */
+static Object
+make_accessor_method (Object generic, Object params, Object body,
+		      int kind, Object allocation, int slot_num)
+{
+  Object meth;
+
+  meth = make_method (GFNAME (generic), params, body, the_env, 0);
+  METHPROPS (meth) |= kind;
+  if (allocation != instance_symbol) {
+    METHPROPS (meth) |= METHCLASSSLOTMASK;
+  }
+  METHSLOTNUM (meth) = slot_num;
+  add_method (generic, meth);
+  return (generic);
 }
 
 
@@ -12,13 +12,35 @@ extern int last_class_index;
 
 #define NEWCLASSINDEX (++last_class_index)
 
+/* whether class c1 is class c2 or inherits from it: a test of the bit
+   for c2 among c1's ancestors, which make_class works out. */
+#define ANCESTOR_BITS (8 * sizeof (unsigned long))
+#define CLASS_SUBTYPE_P(c1, c2) \
+  (CLASSINDEX (c2) / ANCESTOR_BITS < CLASSANCESTORWORDS (c1) \
+   && ((CLASSANCESTORS (c1)[CLASSINDEX (c2) / ANCESTOR_BITS] \
+	>> (CLASSINDEX (c2) % ANCESTOR_BITS)) & 1))
+
+/* what make needs to know about the instances of a class, worked
+   out once by its first make. */
+struct instance_layout {
+    int count;			/* instance slots */
+    Object *slotds;		/* their descriptors, in slot order */
+    int nkeywords;
+    Object *keywords;		/* init keywords, sorted on address */
+    int *keyword_slots;		/* the first slot each initializes */
+    Object init_fun;		/* initialize when default_init was found */
+    int init_epoch;
+    int default_init;		/* initialize would do nothing */
+};
+
 void init_class_prims (void);
 void init_class_hierarchy (void);
 Object make_class (Object class_object, Object supers, Object slot_descriptors,
 		   Object abstract_p, char *debug_name);
 void make_uninstantiable (Object class);
 void make_primary (Object class);
-Object make_instance (Object class, Object *initializers);
+Object make_instance (Object class, Object *initializers,
+		      int want_initializers);
 Object make_singleton (Object val);
 Object make (Object class, Object rest);
 Object instance_p (Object obj, Object class);
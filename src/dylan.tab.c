@@ -0,0 +1,4460 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 1 "dylan.y"
+ /* Emacs: -*- Fundamental -*- */
+
+/* interim-dylan.y -- dylan phrase grammar from 5/12/94 interim report
+   see COPYRIGHT for use */
+
+/*
+ * this grammar is, i believe, an accurate translation of the
+ * BNF grammar in the appendix to the 5/12/94 interim report
+ * into yacc-friendly format.  the differences are
+ *
+ *	+ where the BNF used ellipses to indicate repitition,
+ *	  (right) recursive productions have been added.
+ *
+ *	+ the grammar has been rearranged to eliminate ambiguities
+ *	  (what yacc calls conflicts);  this grammar should have
+ *	  no shift/reduce or reduce/reduce conflicts.  occasional
+ *	  comments explain what had to be done in the dicier of
+ *	  situations.
+ *
+ *	+ according to notes from the partners' mailing list, a
+ *	  few productions were omitted from the grammar in the
+ *	  report;  these are flagged with the comment "omitted"
+ *	  in this grammar.
+ *
+ * paul haahr
+ * 22 may 1994
+ */
+
+/*
+   Marlais Revisions Copyright 1994, Joseph N. Wilson.  All Rights Reserved.
+
+   Permission to use, copy, and modify this software and its
+   documentation is hereby granted only under the following terms and
+   conditions.  Both the above copyright notice and this permission
+   notice must appear in all copies of the software, derivative works
+   or modified version, and both notices must appear in supporting
+   documentation.  Users of this software agree to the terms and
+   conditions set forth in this notice.
+*/
+
+/*
+ * Modified this to have built-in rules for control constructs.
+ * I'll save macro implementation for a little later.
+ *
+ * jnw@cis.ufl.edu
+ * 15 July 1994
+ */
+
+/* #define OPTIMIZE_SPECIALIZERS */
+
+#include "common.h"
+
+#include "boolean.h"
+#include "bytestring.h"
+#include "error.h"
+#include "gc.h"
+#include "list.h"
+#include "number.h"
+#include "symbol.h"
+#include "table.h"
+#include "vector.h"
+#include "yystype.h"
+
+void yyerror (char *);
+static Object append_bang (Object l1, Object l2);
+static Object nelistem (Object car,...);
+
+extern char *yytext;
+extern Object *parse_value_ptr;
+
+extern int yylineno;
+
+void push_intermediate_words (Object begin_word);
+void pop_intermediate_words (void);
+
+Object binding_stack;
+Object symtab;
+Object methnames, methdefs;
+static void push_bindings();
+static void pop_bindings();
+static Object bindings_top ();
+static void bindings_increment ();
+static Object gensym(int i);
+static Object make_setter_expr (Object place, Object value);
+static int allocation_word (Object word);
+
+#line 158 "dylan.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "dylan.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_SYMBOL = 3,                     /* SYMBOL  */
+  YYSYMBOL_KEYWORD = 4,                    /* KEYWORD  */
+  YYSYMBOL_LITERAL = 5,                    /* LITERAL  */
+  YYSYMBOL_STRING = 6,                     /* STRING  */
+  YYSYMBOL_7_ = 7,                         /* '('  */
+  YYSYMBOL_8_ = 8,                         /* ')'  */
+  YYSYMBOL_9_ = 9,                         /* '['  */
+  YYSYMBOL_10_ = 10,                       /* ']'  */
+  YYSYMBOL_11_ = 11,                       /* '{'  */
+  YYSYMBOL_12_ = 12,                       /* '}'  */
+  YYSYMBOL_COLON_EQUAL = 13,               /* COLON_EQUAL  */
+  YYSYMBOL_14_ = 14,                       /* '&'  */
+  YYSYMBOL_15_ = 15,                       /* '|'  */
+  YYSYMBOL_GREATER_EQUAL = 16,             /* GREATER_EQUAL  */
+  YYSYMBOL_LESSER_EQUAL = 17,              /* LESSER_EQUAL  */
+  YYSYMBOL_18_ = 18,                       /* '>'  */
+  YYSYMBOL_19_ = 19,                       /* '<'  */
+  YYSYMBOL_NOT_EQUAL = 20,                 /* NOT_EQUAL  */
+  YYSYMBOL_NOT_EQUAL_EQUAL = 21,           /* NOT_EQUAL_EQUAL  */
+  YYSYMBOL_EQUAL_EQUAL = 22,               /* EQUAL_EQUAL  */
+  YYSYMBOL_23_ = 23,                       /* '='  */
+  YYSYMBOL_24_ = 24,                       /* '-'  */
+  YYSYMBOL_25_ = 25,                       /* '+'  */
+  YYSYMBOL_26_ = 26,                       /* '/'  */
+  YYSYMBOL_27_ = 27,                       /* '*'  */
+  YYSYMBOL_28_ = 28,                       /* '^'  */
+  YYSYMBOL_29_ = 29,                       /* '.'  */
+  YYSYMBOL_30_ = 30,                       /* ','  */
+  YYSYMBOL_31_ = 31,                       /* ';'  */
+  YYSYMBOL_32_ = 32,                       /* '~'  */
+  YYSYMBOL_EQUAL_ARROW = 33,               /* EQUAL_ARROW  */
+  YYSYMBOL_COLON_COLON = 34,               /* COLON_COLON  */
+  YYSYMBOL_QUESTION_QUESTION = 35,         /* QUESTION_QUESTION  */
+  YYSYMBOL_ELLIPSIS = 36,                  /* ELLIPSIS  */
+  YYSYMBOL_UNRECOGNIZED = 37,              /* UNRECOGNIZED  */
+  YYSYMBOL_EOF_TOKEN = 38,                 /* EOF_TOKEN  */
+  YYSYMBOL_HASH_T = 39,                    /* HASH_T  */
+  YYSYMBOL_HASH_F = 40,                    /* HASH_F  */
+  YYSYMBOL_HASH_BRACKET = 41,              /* HASH_BRACKET  */
+  YYSYMBOL_HASH_PAREN = 42,                /* HASH_PAREN  */
+  YYSYMBOL_HASH_NEXT = 43,                 /* HASH_NEXT  */
+  YYSYMBOL_HASH_REST = 44,                 /* HASH_REST  */
+  YYSYMBOL_HASH_KEY = 45,                  /* HASH_KEY  */
+  YYSYMBOL_HASH_ALL_KEYS = 46,             /* HASH_ALL_KEYS  */
+  YYSYMBOL_DEFINE = 47,                    /* DEFINE  */
+  YYSYMBOL_END = 48,                       /* END  */
+  YYSYMBOL_GENERIC = 49,                   /* GENERIC  */
+  YYSYMBOL_HANDLER = 50,                   /* HANDLER  */
+  YYSYMBOL_LET = 51,                       /* LET  */
+  YYSYMBOL_LOCAL = 52,                     /* LOCAL  */
+  YYSYMBOL_METHOD = 53,                    /* METHOD  */
+  YYSYMBOL_FUNCTION = 54,                  /* FUNCTION  */
+  YYSYMBOL_OTHERWISE = 55,                 /* OTHERWISE  */
+  YYSYMBOL_CLASS = 56,                     /* CLASS  */
+  YYSYMBOL_CONSTANT = 57,                  /* CONSTANT  */
+  YYSYMBOL_LIBRARY = 58,                   /* LIBRARY  */
+  YYSYMBOL_MODULE = 59,                    /* MODULE  */
+  YYSYMBOL_VARIABLE = 60,                  /* VARIABLE  */
+  YYSYMBOL_SLOT = 61,                      /* SLOT  */
+  YYSYMBOL_BEGIN_TOKEN = 62,               /* BEGIN_TOKEN  */
+  YYSYMBOL_CASE = 63,                      /* CASE  */
+  YYSYMBOL_IF = 64,                        /* IF  */
+  YYSYMBOL_UNLESS = 65,                    /* UNLESS  */
+  YYSYMBOL_UNTIL = 66,                     /* UNTIL  */
+  YYSYMBOL_WHILE = 67,                     /* WHILE  */
+  YYSYMBOL_BLOCK = 68,                     /* BLOCK  */
+  YYSYMBOL_FOR = 69,                       /* FOR  */
+  YYSYMBOL_SELECT = 70,                    /* SELECT  */
+  YYSYMBOL_USE = 71,                       /* USE  */
+  YYSYMBOL_EXPORT = 72,                    /* EXPORT  */
+  YYSYMBOL_CREATE = 73,                    /* CREATE  */
+  YYSYMBOL_ELSE = 74,                      /* ELSE  */
+  YYSYMBOL_ELSEIF = 75,                    /* ELSEIF  */
+  YYSYMBOL_BY = 76,                        /* BY  */
+  YYSYMBOL_FINALLY = 77,                   /* FINALLY  */
+  YYSYMBOL_THEN = 78,                      /* THEN  */
+  YYSYMBOL_IN = 79,                        /* IN  */
+  YYSYMBOL_FROM = 80,                      /* FROM  */
+  YYSYMBOL_TO = 81,                        /* TO  */
+  YYSYMBOL_ABOVE = 82,                     /* ABOVE  */
+  YYSYMBOL_BELOW = 83,                     /* BELOW  */
+  YYSYMBOL_AFTERWARDS = 84,                /* AFTERWARDS  */
+  YYSYMBOL_CLEANUP = 85,                   /* CLEANUP  */
+  YYSYMBOL_EXCEPTION = 86,                 /* EXCEPTION  */
+  YYSYMBOL_YYACCEPT = 87,                  /* $accept  */
+  YYSYMBOL_defining_word = 88,             /* defining_word  */
+  YYSYMBOL_evaluable_constituent = 89,     /* evaluable_constituent  */
+  YYSYMBOL_body = 90,                      /* body  */
+  YYSYMBOL_nonempty_body = 91,             /* nonempty_body  */
+  YYSYMBOL_92_1 = 92,                      /* $@1  */
+  YYSYMBOL_nonempty_constituents = 93,     /* nonempty_constituents  */
+  YYSYMBOL_constituents = 94,              /* constituents  */
+  YYSYMBOL_constituent = 95,               /* constituent  */
+  YYSYMBOL_expression = 96,                /* expression  */
+  YYSYMBOL_binary_operand = 97,            /* binary_operand  */
+  YYSYMBOL_keyless_binary_operand = 98,    /* keyless_binary_operand  */
+  YYSYMBOL_unary_operator = 99,            /* unary_operator  */
+  YYSYMBOL_operand = 100,                  /* operand  */
+  YYSYMBOL_unparenthesized_operand = 101,  /* unparenthesized_operand  */
+  YYSYMBOL_arguments = 102,                /* arguments  */
+  YYSYMBOL_leaf = 103,                     /* leaf  */
+  YYSYMBOL_unparenthesized_leaf = 104,     /* unparenthesized_leaf  */
+  YYSYMBOL_literal = 105,                  /* literal  */
+  YYSYMBOL_strings = 106,                  /* strings  */
+  YYSYMBOL_component_strings = 107,        /* component_strings  */
+  YYSYMBOL_constants = 108,                /* constants  */
+  YYSYMBOL_list_constants = 109,           /* list_constants  */
+  YYSYMBOL_constant = 110,                 /* constant  */
+  YYSYMBOL_statement = 111,                /* statement  */
+  YYSYMBOL_begin_statement = 112,          /* begin_statement  */
+  YYSYMBOL_113_2 = 113,                    /* $@2  */
+  YYSYMBOL_if_statement = 114,             /* if_statement  */
+  YYSYMBOL_115_3 = 115,                    /* $@3  */
+  YYSYMBOL_116_4 = 116,                    /* $@4  */
+  YYSYMBOL_then_body = 117,                /* then_body  */
+  YYSYMBOL_else_parts = 118,               /* else_parts  */
+  YYSYMBOL_unless_statement = 119,         /* unless_statement  */
+  YYSYMBOL_case_statement = 120,           /* case_statement  */
+  YYSYMBOL_case_body = 121,                /* case_body  */
+  YYSYMBOL_122_5 = 122,                    /* $@5  */
+  YYSYMBOL_case_tail = 123,                /* case_tail  */
+  YYSYMBOL_124_6 = 124,                    /* $@6  */
+  YYSYMBOL_125_7 = 125,                    /* $@7  */
+  YYSYMBOL_case_label = 126,               /* case_label  */
+  YYSYMBOL_select_statement = 127,         /* select_statement  */
+  YYSYMBOL_128_8 = 128,                    /* $@8  */
+  YYSYMBOL_129_9 = 129,                    /* $@9  */
+  YYSYMBOL_test_opt = 130,                 /* test_opt  */
+  YYSYMBOL_select_body = 131,              /* select_body  */
+  YYSYMBOL_132_10 = 132,                   /* $@10  */
+  YYSYMBOL_select_tail = 133,              /* select_tail  */
+  YYSYMBOL_134_11 = 134,                   /* $@11  */
+  YYSYMBOL_135_12 = 135,                   /* $@12  */
+  YYSYMBOL_select_label = 136,             /* select_label  */
+  YYSYMBOL_while_statement = 137,          /* while_statement  */
+  YYSYMBOL_until_statement = 138,          /* until_statement  */
+  YYSYMBOL_for_statement = 139,            /* for_statement  */
+  YYSYMBOL_140_13 = 140,                   /* $@13  */
+  YYSYMBOL_141_14 = 141,                   /* $@14  */
+  YYSYMBOL_142_15 = 142,                   /* $@15  */
+  YYSYMBOL_for_clauses = 143,              /* for_clauses  */
+  YYSYMBOL_for_clauses_opt = 144,          /* for_clauses_opt  */
+  YYSYMBOL_for_clause = 145,               /* for_clause  */
+  YYSYMBOL_bound_opt = 146,                /* bound_opt  */
+  YYSYMBOL_increment_clause_opt = 147,     /* increment_clause_opt  */
+  YYSYMBOL_for_terminator_opt = 148,       /* for_terminator_opt  */
+  YYSYMBOL_finally_opt = 149,              /* finally_opt  */
+  YYSYMBOL_block_statement = 150,          /* block_statement  */
+  YYSYMBOL_151_16 = 151,                   /* $@16  */
+  YYSYMBOL_152_17 = 152,                   /* $@17  */
+  YYSYMBOL_afterwards_opt = 153,           /* afterwards_opt  */
+  YYSYMBOL_cleanup_opt = 154,              /* cleanup_opt  */
+  YYSYMBOL_exceptions = 155,               /* exceptions  */
+  YYSYMBOL_exception_args = 156,           /* exception_args  */
+  YYSYMBOL_IF_opt = 157,                   /* IF_opt  */
+  YYSYMBOL_UNLESS_opt = 158,               /* UNLESS_opt  */
+  YYSYMBOL_CASE_opt = 159,                 /* CASE_opt  */
+  YYSYMBOL_SELECT_opt = 160,               /* SELECT_opt  */
+  YYSYMBOL_WHILE_opt = 161,                /* WHILE_opt  */
+  YYSYMBOL_UNTIL_opt = 162,                /* UNTIL_opt  */
+  YYSYMBOL_FOR_opt = 163,                  /* FOR_opt  */
+  YYSYMBOL_BLOCK_opt = 164,                /* BLOCK_opt  */
+  YYSYMBOL_defining_form = 165,            /* defining_form  */
+  YYSYMBOL_166_18 = 166,                   /* $@18  */
+  YYSYMBOL_167_19 = 167,                   /* $@19  */
+  YYSYMBOL_class_definition = 168,         /* class_definition  */
+  YYSYMBOL_slot_specs = 169,               /* slot_specs  */
+  YYSYMBOL_slot_spec = 170,                /* slot_spec  */
+  YYSYMBOL_slot_modifiers_opt = 171,       /* slot_modifiers_opt  */
+  YYSYMBOL_initialization_argument_spec = 172, /* initialization_argument_spec  */
+  YYSYMBOL_method_definition = 173,        /* method_definition  */
+  YYSYMBOL_function_definition = 174,      /* function_definition  */
+  YYSYMBOL_generic_function_definition = 175, /* generic_function_definition  */
+  YYSYMBOL_module_definition = 176,        /* module_definition  */
+  YYSYMBOL_module_clauses = 177,           /* module_clauses  */
+  YYSYMBOL_module_clause = 178,            /* module_clause  */
+  YYSYMBOL_use_clause = 179,               /* use_clause  */
+  YYSYMBOL_export_clause = 180,            /* export_clause  */
+  YYSYMBOL_create_clause = 181,            /* create_clause  */
+  YYSYMBOL_modifiers = 182,                /* modifiers  */
+  YYSYMBOL_expression_list = 183,          /* expression_list  */
+  YYSYMBOL_expressions = 184,              /* expressions  */
+  YYSYMBOL_item_names = 185,               /* item_names  */
+  YYSYMBOL_method_body = 186,              /* method_body  */
+  YYSYMBOL_187_20 = 187,                   /* $@20  */
+  YYSYMBOL_generic_function_body = 188,    /* generic_function_body  */
+  YYSYMBOL_parameter_list = 189,           /* parameter_list  */
+  YYSYMBOL_next_rest_key_parameter_list = 190, /* next_rest_key_parameter_list  */
+  YYSYMBOL_rest_key_parameter_list = 191,  /* rest_key_parameter_list  */
+  YYSYMBOL_key_parameter_list = 192,       /* key_parameter_list  */
+  YYSYMBOL_parameter = 193,                /* parameter  */
+  YYSYMBOL_keyword_parameters = 194,       /* keyword_parameters  */
+  YYSYMBOL_keyword_parameter = 195,        /* keyword_parameter  */
+  YYSYMBOL_default = 196,                  /* default  */
+  YYSYMBOL_local_declaration = 197,        /* local_declaration  */
+  YYSYMBOL_198_21 = 198,                   /* $@21  */
+  YYSYMBOL_condition = 199,                /* condition  */
+  YYSYMBOL_handler = 200,                  /* handler  */
+  YYSYMBOL_local_methods = 201,            /* local_methods  */
+  YYSYMBOL_202_22 = 202,                   /* $@22  */
+  YYSYMBOL_bindings = 203,                 /* bindings  */
+  YYSYMBOL_variable_list = 204,            /* variable_list  */
+  YYSYMBOL_value_variable_list = 205,      /* value_variable_list  */
+  YYSYMBOL_variable = 206,                 /* variable  */
+  YYSYMBOL_variable_name = 207,            /* variable_name  */
+  YYSYMBOL_variable_name_opt = 208,        /* variable_name_opt  */
+  YYSYMBOL_type_designator = 209,          /* type_designator  */
+  YYSYMBOL_type = 210,                     /* type  */
+  YYSYMBOL_property_list = 211,            /* property_list  */
+  YYSYMBOL_property = 212,                 /* property  */
+  YYSYMBOL_value = 213,                    /* value  */
+  YYSYMBOL_property_set = 214,             /* property_set  */
+  YYSYMBOL_property_set_member = 215,      /* property_set_member  */
+  YYSYMBOL_property_set_item = 216,        /* property_set_item  */
+  YYSYMBOL_EQUAL_ARROW_opt = 217,          /* EQUAL_ARROW_opt  */
+  YYSYMBOL_METHOD_opt = 218,               /* METHOD_opt  */
+  YYSYMBOL_FUNCTION_opt = 219,             /* FUNCTION_opt  */
+  YYSYMBOL_CLASS_opt = 220,                /* CLASS_opt  */
+  YYSYMBOL_MODULE_opt = 221,               /* MODULE_opt  */
+  YYSYMBOL_SEMICOLON_opt = 222,            /* SEMICOLON_opt  */
+  YYSYMBOL_comma_opt = 223,                /* comma_opt  */
+  YYSYMBOL_comma_arguments_opt = 224,      /* comma_arguments_opt  */
+  YYSYMBOL_arguments_opt = 225,            /* arguments_opt  */
+  YYSYMBOL_constants_opt = 226,            /* constants_opt  */
+  YYSYMBOL_list_constants_opt = 227,       /* list_constants_opt  */
+  YYSYMBOL_default_opt = 228,              /* default_opt  */
+  YYSYMBOL_expressions_opt = 229,          /* expressions_opt  */
+  YYSYMBOL_modifiers_opt = 230,            /* modifiers_opt  */
+  YYSYMBOL_parameter_list_opt = 231,       /* parameter_list_opt  */
+  YYSYMBOL_property_list_opt = 232,        /* property_list_opt  */
+  YYSYMBOL_property_set_opt = 233,         /* property_set_opt  */
+  YYSYMBOL_type_designator_opt = 234,      /* type_designator_opt  */
+  YYSYMBOL_value_list_opt = 235            /* value_list_opt  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  96
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   1411
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  87
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  149
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  330
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  544
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   321
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,    14,     2,
+       7,     8,    27,    25,    30,    24,    29,    26,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,    31,
+      19,    23,    18,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     9,     2,    10,    28,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    11,    15,    12,    32,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,    13,    16,    17,    20,    21,    22,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   161,   161,   162,   163,   164,   165,   175,   177,   180,
+     183,   193,   195,   200,   207,   208,   211,   211,   229,   230,
+     233,   234,   235,   242,   243,   244,   252,   254,   261,   263,
+     265,   267,   269,   271,   273,   275,   277,   279,   281,   283,
+     285,   287,   289,   297,   298,   301,   302,   306,   307,   309,
+     318,   325,   327,   330,   338,   340,   342,   345,   346,   347,
+     349,   352,   353,   356,   357,   358,   360,   362,   363,   364,
+     365,   366,   368,   371,   372,   376,   377,   380,   381,   384,
+     389,   391,   395,   396,   402,   403,   404,   405,   406,   407,
+     408,   409,   410,   418,   417,   433,   436,   433,   445,   446,
+     449,   450,   451,   452,   462,   467,   472,   474,   473,   487,
+     488,   490,   489,   503,   506,   510,   510,   527,   529,   533,
+     535,   533,   542,   543,   545,   547,   546,   559,   560,   562,
+     561,   575,   578,   582,   582,   599,   601,   603,   607,   611,
+     615,   618,   620,   615,   628,   629,   632,   633,   636,   638,
+     641,   648,   649,   651,   653,   657,   658,   662,   664,   665,
+     669,   684,   685,   688,   694,   688,   723,   724,   727,   728,
+     731,   732,   738,   739,   743,   744,   747,   748,   751,   752,
+     755,   756,   759,   760,   763,   764,   767,   768,   771,   772,
+     775,   779,   783,   789,   792,   796,   795,   813,   812,   818,
+     823,   824,   825,   829,   831,   892,   893,   894,   897,   905,
+     916,   920,   924,   932,   936,   937,   941,   942,   943,   946,
+     950,   952,   955,   956,   959,   962,   963,   982,   983,   990,
+     989,  1002,  1008,  1013,  1015,  1019,  1024,  1025,  1027,  1029,
+    1033,  1035,  1037,  1041,  1043,  1045,  1049,  1050,  1052,  1054,
+    1058,  1062,  1068,  1069,  1070,  1075,  1091,  1101,  1118,  1130,
+    1131,  1131,  1150,  1151,  1153,  1156,  1162,  1161,  1169,  1172,
+    1177,  1178,  1180,  1185,  1186,  1188,  1192,  1197,  1198,  1201,
+    1202,  1205,  1207,  1213,  1214,  1217,  1220,  1221,  1224,  1225,
+    1228,  1229,  1233,  1239,  1240,  1243,  1244,  1247,  1248,  1251,
+    1252,  1255,  1256,  1259,  1260,  1263,  1264,  1267,  1268,  1271,
+    1272,  1275,  1276,  1279,  1281,  1284,  1285,  1298,  1299,  1308,
+    1309,  1312,  1313,  1316,  1317,  1320,  1321,  1324,  1325,  1328,
+    1329
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "SYMBOL", "KEYWORD",
+  "LITERAL", "STRING", "'('", "')'", "'['", "']'", "'{'", "'}'",
+  "COLON_EQUAL", "'&'", "'|'", "GREATER_EQUAL", "LESSER_EQUAL", "'>'",
+  "'<'", "NOT_EQUAL", "NOT_EQUAL_EQUAL", "EQUAL_EQUAL", "'='", "'-'",
+  "'+'", "'/'", "'*'", "'^'", "'.'", "','", "';'", "'~'", "EQUAL_ARROW",
+  "COLON_COLON", "QUESTION_QUESTION", "ELLIPSIS", "UNRECOGNIZED",
+  "EOF_TOKEN", "HASH_T", "HASH_F", "HASH_BRACKET", "HASH_PAREN",
+  "HASH_NEXT", "HASH_REST", "HASH_KEY", "HASH_ALL_KEYS", "DEFINE", "END",
+  "GENERIC", "HANDLER", "LET", "LOCAL", "METHOD", "FUNCTION", "OTHERWISE",
+  "CLASS", "CONSTANT", "LIBRARY", "MODULE", "VARIABLE", "SLOT",
+  "BEGIN_TOKEN", "CASE", "IF", "UNLESS", "UNTIL", "WHILE", "BLOCK", "FOR",
+  "SELECT", "USE", "EXPORT", "CREATE", "ELSE", "ELSEIF", "BY", "FINALLY",
+  "THEN", "IN", "FROM", "TO", "ABOVE", "BELOW", "AFTERWARDS", "CLEANUP",
+  "EXCEPTION", "$accept", "defining_word", "evaluable_constituent", "body",
+  "nonempty_body", "$@1", "nonempty_constituents", "constituents",
+  "constituent", "expression", "binary_operand", "keyless_binary_operand",
+  "unary_operator", "operand", "unparenthesized_operand", "arguments",
+  "leaf", "unparenthesized_leaf", "literal", "strings",
+  "component_strings", "constants", "list_constants", "constant",
+  "statement", "begin_statement", "$@2", "if_statement", "$@3", "$@4",
+  "then_body", "else_parts", "unless_statement", "case_statement",
+  "case_body", "$@5", "case_tail", "$@6", "$@7", "case_label",
+  "select_statement", "$@8", "$@9", "test_opt", "select_body", "$@10",
+  "select_tail", "$@11", "$@12", "select_label", "while_statement",
+  "until_statement", "for_statement", "$@13", "$@14", "$@15",
+  "for_clauses", "for_clauses_opt", "for_clause", "bound_opt",
+  "increment_clause_opt", "for_terminator_opt", "finally_opt",
+  "block_statement", "$@16", "$@17", "afterwards_opt", "cleanup_opt",
+  "exceptions", "exception_args", "IF_opt", "UNLESS_opt", "CASE_opt",
+  "SELECT_opt", "WHILE_opt", "UNTIL_opt", "FOR_opt", "BLOCK_opt",
+  "defining_form", "$@18", "$@19", "class_definition", "slot_specs",
+  "slot_spec", "slot_modifiers_opt", "initialization_argument_spec",
+  "method_definition", "function_definition",
+  "generic_function_definition", "module_definition", "module_clauses",
+  "module_clause", "use_clause", "export_clause", "create_clause",
+  "modifiers", "expression_list", "expressions", "item_names",
+  "method_body", "$@20", "generic_function_body", "parameter_list",
+  "next_rest_key_parameter_list", "rest_key_parameter_list",
+  "key_parameter_list", "parameter", "keyword_parameters",
+  "keyword_parameter", "default", "local_declaration", "$@21", "condition",
+  "handler", "local_methods", "$@22", "bindings", "variable_list",
+  "value_variable_list", "variable", "variable_name", "variable_name_opt",
+  "type_designator", "type", "property_list", "property", "value",
+  "property_set", "property_set_member", "property_set_item",
+  "EQUAL_ARROW_opt", "METHOD_opt", "FUNCTION_opt", "CLASS_opt",
+  "MODULE_opt", "SEMICOLON_opt", "comma_opt", "comma_arguments_opt",
+  "arguments_opt", "constants_opt", "list_constants_opt", "default_opt",
+  "expressions_opt", "modifiers_opt", "parameter_list_opt",
+  "property_list_opt", "property_set_opt", "type_designator_opt",
+  "value_list_opt", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-477)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-226)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+     559,    12,  -477,  -477,  -477,    53,  1106,  -477,  -477,  -477,
+    -477,  -477,  -477,   138,   138,    36,   290,  -477,    37,  -477,
+    -477,  -477,  -477,  -477,  -477,   970,  -477,    44,    60,    66,
+    -477,  -477,  -477,  -477,    76,   829,  -477,  -477,   416,    31,
+    -477,  -477,  -477,  -477,  -477,  -477,  -477,  -477,  -477,  -477,
+    -477,  -477,  -477,  -477,   114,  -477,  -477,  -477,  -477,    53,
+    -477,  1277,  -477,  -477,  -477,   128,   151,  -477,   123,   168,
+     190,    25,  -477,    25,  -477,   204,   277,   460,  -477,   172,
+     163,   174,   178,   156,   177,   183,   761,   192,  -477,   234,
+    1106,  1106,  1106,   236,   238,   242,  -477,  1106,  1106,  1106,
+    1106,  1106,  1106,  1106,  1106,  1106,  1106,  1106,  1106,  1106,
+    1106,  1106,  1106,  -477,    31,  1174,  1174,   394,  -477,  -477,
+    -477,   138,  -477,   138,   138,  -477,  -477,  -477,   394,  -477,
+     394,   394,   394,  -477,   394,   243,   231,   416,    45,  -477,
+     239,  1106,   416,  -477,  -477,  -477,  -477,   394,   394,   394,
+     225,  -477,   240,  -477,  -477,  -477,  -477,    27,   261,   174,
+     224,  -477,   902,  -477,  -477,  -477,   211,   766,  1106,  1299,
+    1320,  1341,   394,   394,  1106,  1101,   551,   551,   360,   360,
+     360,   360,   360,   360,   360,   360,   112,   112,   248,   248,
+    -477,  1106,   897,  -477,   269,   268,  -477,  -477,  -477,  -477,
+    -477,    84,  -477,   272,  -477,    37,  -477,    37,   394,  -477,
+     263,   277,    31,   257,  1174,  1174,   394,  1106,  1101,  -477,
+     260,   262,   264,   394,   245,  -477,  -477,   265,   163,   178,
+    1106,  -477,   266,  -477,  -477,  -477,   273,  1101,  -477,  -477,
+    -477,  -477,   970,   274,   280,  1362,   177,   177,   177,   288,
+    -477,     3,   286,     7,  1235,   965,  1174,  -477,  -477,   394,
+     394,   394,   255,   287,  -477,  -477,  -477,   178,  -477,   271,
+     275,  -477,   313,  1106,  -477,   318,  -477,   257,   317,   321,
+     316,  -477,  1101,  -477,  -477,   120,   173,   163,  -477,   297,
+     315,  -477,  -477,  1101,   388,   280,   902,  -477,   630,  -477,
+    -477,    85,   294,   296,   310,   -38,  1106,  1106,  1106,  -477,
+     394,  -477,  1106,  1106,  1106,  1106,  -477,  1174,  -477,   257,
+    -477,   329,  -477,   302,    84,   354,   174,   314,  1106,    10,
+    1101,   143,  -477,  -477,  -477,  -477,   174,  -477,  -477,   315,
+    -477,  1106,  -477,  -477,   307,   338,   177,  -477,   340,   766,
+     761,  -477,  -477,  -477,   157,   308,   306,   312,   305,  1101,
+    1101,  1101,   366,  -477,  1169,  1101,   415,  1101,   372,  -477,
+    -477,   394,  -477,   394,  -477,   348,   394,  -477,   394,  1033,
+    -477,   382,    33,   134,   344,   362,   335,  -477,   394,  1101,
+    -477,  -477,  -477,  1101,   394,  -477,   368,   391,   177,  -477,
+     902,  -477,   766,   352,   395,  -477,  -477,  -477,  -477,  -477,
+    -477,  -477,   -29,   319,   -19,  1106,  1106,  1106,  1106,   327,
+    1038,  -477,  -477,  -477,   488,  -477,  -477,  1106,  -477,    38,
+     376,  -477,   134,  -477,   351,    10,   394,  -477,  -477,   378,
+     379,   397,  -477,   307,   280,  -477,  -477,  -477,  -477,  1106,
+     363,  -477,   -21,  -477,   336,  1101,  1101,  1101,  1101,  1106,
+    -477,  1106,   183,   377,  -477,   381,   307,  -477,  -477,   376,
+    1174,  -477,  -477,   394,  -477,   376,   394,   394,  -477,  -477,
+     177,  1383,   398,  -477,   385,   177,   420,  1101,  1256,  -477,
+     407,   834,  -477,   456,  -477,  -477,  -477,  -477,  -477,  -477,
+    -477,    88,  -477,  -477,   481,   442,  -477,  -477,  1106,  -477,
+    -477,  1038,   462,   280,  -477,   157,   394,   435,   436,   498,
+    -477,   698,  -477,  -477,   499,   475,  -477,  -477,  -477,  -477,
+     479,   834,   693,  -477,  -477,   -21,   394,  -477,  -477,   834,
+    -477,   376,  -477,  -477
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+       0,     0,   277,    43,    67,    73,     0,    47,     7,    48,
+      11,    69,    70,   311,   313,   319,     0,   260,     0,     2,
+       3,     4,     5,     6,    93,   106,    95,     0,     0,     0,
+     163,   140,   119,   278,     0,     0,    26,    44,     0,    45,
+      52,    62,    63,    68,    66,    84,    85,    86,    87,    88,
+      89,    90,    91,    92,     0,    10,    64,    12,    13,    75,
+      74,     0,    83,    82,   312,    77,     0,   314,    79,     0,
+     222,     0,   197,     0,   320,     0,     0,     0,   258,     0,
+     327,   295,   321,     0,    16,   293,     0,     0,   107,     0,
+       0,     0,     0,     0,     0,     0,     1,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     9,    46,   309,   309,     0,     8,    76,
+      61,     0,    72,     0,     0,    71,   223,   194,     0,   193,
+       0,     0,     0,   195,     0,     0,   270,     0,   262,    56,
+       0,     0,     0,   328,   276,   296,   261,     0,     0,     0,
+     246,   249,   322,   239,   242,   245,   236,   327,     0,   295,
+       0,    15,     0,   294,   118,   117,   178,   109,     0,     0,
+       0,     0,     0,   146,     0,    27,    28,    29,    30,    31,
+      33,    32,    34,    35,    36,    37,    38,    39,    40,    41,
+      42,    43,    58,   310,     0,     0,    51,    78,    80,    81,
+     198,   214,   192,     0,   190,     0,   191,     0,     0,   272,
+       0,     0,   282,   323,   309,     0,     0,     0,   268,   281,
+     265,   240,   243,     0,     0,   253,   248,   252,   327,     0,
+       0,   250,   229,    65,    94,    17,    18,    25,    23,    24,
+     179,   105,   110,   113,   303,     0,    16,    16,    16,     0,
+     147,   157,   305,     0,   122,    57,     0,    49,    50,     0,
+       0,     0,     0,     0,   216,   217,   218,   321,   212,     0,
+       0,   196,     0,     0,   271,     0,   324,   283,     0,     0,
+       0,    55,   264,   259,   266,     0,     0,   327,   247,     0,
+     315,   238,   237,   251,     0,   303,    20,   111,   109,   304,
+     108,    16,     0,     0,     0,    16,     0,     0,     0,   141,
+     306,   144,     0,     0,     0,     0,   120,     0,    60,   323,
+     220,   227,   221,   301,   214,     0,   295,   297,   317,   200,
+     269,     0,   284,   263,    53,    54,   295,   241,   244,   315,
+     254,     0,   316,   256,   329,     0,    16,    19,    21,   109,
+      25,   114,   115,    99,   100,   176,   184,   182,   166,   160,
+     158,   159,     0,   145,     0,   149,   151,   123,     0,    59,
+     219,     0,   302,   279,   215,   233,   279,   298,   279,   225,
+     318,     0,   205,   205,     0,   201,     0,   203,   325,   286,
+     285,   267,   255,   257,     0,   330,   273,     0,    16,   230,
+      20,   112,   109,    16,     0,    96,   177,   104,   185,   139,
+     183,   138,    16,   168,    16,     0,     0,     0,     0,   155,
+     124,   228,   280,   213,     0,   210,   211,     0,   224,   205,
+     307,   206,   205,   207,   299,   200,     0,   292,   326,   288,
+     290,     0,   275,     0,   303,   231,    22,   116,   102,     0,
+       0,   167,    16,   170,   161,   148,   152,   153,   154,     0,
+     150,     0,   293,     0,   125,     0,   329,   234,   226,   307,
+       0,   208,   300,   279,   202,   307,     0,     0,   287,   274,
+      16,     0,   174,   169,   164,    16,     0,   156,     0,   137,
+     180,   127,   135,     0,   209,   308,   199,   204,   289,   291,
+     232,    16,   175,    97,     0,     0,   162,   142,     0,   181,
+     121,   128,   131,   303,   235,   100,     0,   188,   186,     0,
+     129,   127,   126,   103,     0,   172,   189,   165,   187,   143,
+       0,   127,    25,   132,   133,    16,     0,   136,   130,   127,
+     171,   307,   134,   173
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -477,  -477,  -477,  -226,  -275,  -477,  -477,   115,  -161,     0,
+    -477,  -477,  -477,   -15,  -477,  -203,  -477,   437,     2,  -477,
+     472,   411,   409,    -6,  -477,  -477,  -477,  -477,  -477,  -477,
+    -477,    19,  -477,  -477,  -477,  -477,  -281,  -477,  -477,  -218,
+    -477,  -477,  -477,  -477,  -477,  -477,  -476,  -477,  -477,  -433,
+    -477,  -477,  -477,  -477,  -477,  -477,   226,  -477,  -477,  -477,
+    -477,  -477,  -477,  -477,  -477,  -477,  -477,  -477,  -477,  -477,
+    -477,  -477,  -477,  -477,  -477,  -477,  -477,  -477,   535,  -477,
+    -477,  -477,   102,  -477,  -311,  -477,   392,  -477,  -477,  -477,
+     214,  -477,  -477,  -477,  -477,   471,  -477,  -314,  -252,  -143,
+    -477,  -477,  -477,   320,   258,   256,   322,   267,  -477,  -477,
+     550,  -477,  -477,  -477,   217,  -477,   100,   343,   118,   -42,
+     116,  -343,  -477,   413,   281,  -477,  -477,    81,  -477,   103,
+     119,  -156,  -477,  -477,  -477,  -293,  -477,  -464,   -85,  -477,
+    -477,   246,  -477,  -477,   328,   283,  -477,  -153,   121
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,    33,    34,   160,   161,   162,   235,   347,   243,   237,
+      36,    37,    38,    39,   138,   193,    40,    41,    42,    43,
+      60,    64,    67,    65,    44,    45,    84,    46,    89,   450,
+     354,   405,    47,    48,    87,   167,   244,   349,   402,    88,
+      49,    95,   368,   316,   463,   491,   513,   531,   539,   464,
+      50,    51,    52,    94,   362,   518,   250,   251,   252,   419,
+     460,   309,   486,    53,    93,   505,   413,   453,   484,   524,
+     503,   407,   241,   510,   411,   409,   529,   527,   238,   208,
+     128,   271,   384,   385,   431,   387,   204,   206,   202,   200,
+     262,   263,   264,   265,   266,    74,   329,   465,   320,    83,
+     295,   268,   152,   153,   154,   155,   156,   226,   227,   342,
+     239,    81,   140,   283,   146,   336,    78,   135,   395,    79,
+      56,   423,   143,   213,   276,   277,   390,   438,   439,   440,
+     164,   147,   378,   473,   373,   300,   311,   471,   194,    66,
+      69,   343,   381,    75,   158,   278,   441,   144,   397
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      35,   236,   346,   233,   231,   494,    61,   306,    68,   322,
+     -14,   497,   280,   382,   380,    63,    63,   351,   386,   -14,
+     302,   303,   304,   114,   297,    86,   353,   -14,     2,   -14,
+     312,   195,    76,   425,   136,   426,   429,   430,   115,    70,
+     116,   432,   469,    57,    82,   533,   -14,   -14,   -14,   230,
+      58,    90,   214,   318,   215,   538,   -14,   -14,   -14,    59,
+     117,   142,   269,   542,   270,   -14,   383,    91,   401,   307,
+     308,  -205,   433,    92,   216,   290,    96,   543,   520,   358,
+     352,    19,    20,    21,    22,    23,   313,   314,   534,   383,
+     169,   170,   171,    71,   383,    72,    73,   175,   176,   177,
+     178,   179,   180,   181,   182,   183,   184,   185,   186,   187,
+     188,   189,   190,   468,   369,   192,   192,   198,    68,   421,
+     399,   447,   212,    63,   386,    63,    63,   212,   448,   279,
+     496,   253,    80,   -98,   339,   348,   -14,   432,   110,   111,
+     112,   218,    62,     4,     5,   118,     2,     3,     4,     5,
+       6,   480,   123,   124,   388,   259,   260,   261,   121,   -98,
+     -98,   122,   -14,   -14,   149,   150,   151,     7,   245,   136,
+     376,   127,   445,   129,   254,     9,   125,    11,    12,    13,
+      14,     2,    11,    12,    13,    14,   451,    80,   454,    80,
+     383,   255,    80,    70,   519,   141,    18,   142,   157,    19,
+      20,    21,    22,    23,   159,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,   192,   192,   163,   282,   150,   151,
+     522,   148,   149,   150,   151,   -14,   483,   145,     2,   223,
+     293,   403,   404,   196,    19,    20,    21,    22,    23,   348,
+     166,   168,    86,   172,   201,   173,   203,   205,   207,   174,
+     209,   210,   345,   130,   500,   224,   192,   131,   132,   506,
+     133,   211,   217,   205,   221,   222,   228,   495,   253,   232,
+     229,   225,   234,   330,   240,   515,   112,   257,   258,   267,
+       2,    19,    20,    21,    22,    23,   273,   275,   249,    80,
+     284,   288,   285,     2,   286,   289,   305,    76,   350,   294,
+       2,   223,   396,   323,   296,   298,   359,   360,   361,   540,
+       2,   299,   364,   365,   366,   367,   310,   192,   324,   326,
+     328,   134,   331,   327,   272,   333,   335,    80,   379,   334,
+     512,   389,   281,    19,    20,    21,    22,    23,   341,   287,
+      77,   393,   355,   225,   356,   157,    19,    20,    21,    22,
+      23,   394,   442,    19,    20,    21,    22,    23,   357,   371,
+     512,   372,   375,    19,    20,    21,    22,    23,   377,   398,
+     512,   400,   408,   406,   414,   319,   321,   321,   512,   410,
+     420,   424,   467,   157,   108,   109,   110,   111,   112,   412,
+     428,     2,   434,   435,   475,   344,   436,     2,   443,   444,
+    -101,   396,   449,   459,   452,   228,   470,   472,   476,   478,
+      80,   482,   477,   485,   492,   455,   456,   457,   458,     2,
+     379,     4,     5,     6,   396,   490,    80,   379,    97,    98,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,    19,    20,    21,    22,    23,   481,
+      19,    20,    21,    22,    23,    11,    12,    13,    14,   487,
+      80,   488,   502,     2,   514,     4,     5,   137,   507,    18,
+     192,   504,    19,    20,    21,    22,    23,   509,    24,    25,
+      26,    27,    28,    29,    30,    31,    32,   321,   516,   422,
+     517,     2,   422,   521,   422,   466,   416,   417,   418,    11,
+      12,    13,    14,   526,   437,   528,   530,   535,   379,   536,
+      80,   379,   537,    18,   139,   446,    19,    20,    21,    22,
+      23,   532,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,   119,   197,   199,   523,    54,   363,   474,   374,   220,
+      80,   126,   338,   337,    19,    20,    21,    22,    23,   291,
+      55,   292,    80,   391,   274,   219,   340,   498,   332,    80,
+       1,   479,     2,     3,     4,     5,     6,   100,   101,   102,
+     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+     499,   489,    80,     7,     0,   392,     0,   493,     0,   422,
+       8,     9,   437,   437,     0,   325,     0,    10,    11,    12,
+      13,    14,   370,     0,     0,     0,    15,     0,     0,     0,
+      16,    17,    18,     0,     0,    19,    20,    21,    22,    23,
+       0,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+       0,     0,   525,     2,     3,     4,     5,     6,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   541,     0,     7,     0,     0,     0,     0,     0,
+       0,   242,     9,     0,     0,     0,     0,     0,     0,    11,
+      12,    13,    14,     0,     0,     0,     0,    15,     0,     0,
+       0,    16,    17,    18,     0,    85,    19,    20,    21,    22,
+      23,     0,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,     2,     3,     4,     5,   461,    97,    98,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,     7,   427,     0,     0,  -225,     0,     0,   511,
+       9,     0,     0,     0,     0,     0,     0,    11,    12,    13,
+      14,     0,     0,     0,     0,    15,     0,     0,     0,    16,
+      17,    18,     0,   462,    19,    20,    21,    22,    23,     0,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,     2,
+       3,     4,     5,     6,    97,    98,    99,   100,   101,   102,
+     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+       7,     0,     0,     0,   165,     0,     0,   242,     9,     0,
+       0,     0,     0,     0,     0,    11,    12,    13,    14,     0,
+       0,     0,     0,    15,     0,     0,     0,    16,    17,    18,
+       0,     0,    19,    20,    21,    22,    23,     0,    24,    25,
+      26,    27,    28,    29,    30,    31,    32,     2,     3,     4,
+       5,     6,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,     7,     0,
+     113,     0,     0,     0,     0,   511,     9,     0,     0,     0,
+       0,     0,     0,    11,    12,    13,    14,     0,     0,     0,
+       0,    15,     0,     0,     0,    16,    17,    18,     0,     0,
+      19,    20,    21,    22,    23,     0,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,     2,     3,     4,     5,     6,
+      97,    98,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,     7,   256,     0,     0,
+       0,     0,     0,     0,     9,     0,     0,     0,     0,     0,
+       0,    11,    12,    13,    14,     0,     0,     0,     0,    15,
+       0,     0,     0,    16,    17,    18,     0,     0,    19,    20,
+      21,    22,    23,     0,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,     2,     3,     4,     5,     6,    97,    98,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,     7,   317,     0,     0,     0,     0,
+       0,     0,     9,     0,     0,     0,     0,     0,     0,    11,
+      12,    13,    14,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    18,     0,    85,    19,    20,    21,    22,
+      23,     0,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,     2,     3,     4,     5,   461,    97,    98,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,     7,   427,     0,     0,     0,     0,     0,     0,
+       9,     0,     0,     0,     0,     0,     0,    11,    12,    13,
+      14,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    18,     0,   462,    19,    20,    21,    22,    23,     0,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,     2,
+       3,     4,     5,     6,    97,    98,    99,   100,   101,   102,
+     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+       7,     0,     0,     0,     0,     0,     0,     0,     9,     0,
+       0,     0,     0,     0,     0,    11,    12,    13,    14,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    18,
+       0,     0,    19,    20,    21,    22,    23,     0,    24,    25,
+      26,    27,    28,    29,    30,    31,    32,     2,   191,     4,
+       5,     6,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,     7,     0,
+       0,     0,     0,     0,     0,     0,     9,     0,     0,     0,
+       0,     0,     0,    11,    12,    13,    14,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    18,     0,     0,
+      19,    20,    21,    22,    23,     0,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,     0,     0,   415,    97,    98,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   120,     0,     0,     0,     0,    97,
+      98,    99,   100,   101,   102,   103,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   120,   508,     0,     0,     0,
+      97,    98,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,     0,   246,     0,     0,
+       0,   315,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   247,     0,
+       0,     0,     0,    97,    98,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   248,
+       0,     0,     0,     0,    97,    98,    99,   100,   101,   102,
+     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+     301,     0,     0,     0,     0,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   501,     0,     0,     0,     0,    97,    98,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112
+};
+
+static const yytype_int16 yycheck[] =
+{
+       0,   162,   295,   159,   157,   469,     6,     4,    14,   261,
+      48,   475,   215,     3,   328,    13,    14,   298,   329,    48,
+     246,   247,   248,    38,   242,    25,   301,    48,     3,    48,
+      23,   116,     7,   376,    76,   378,     3,     4,     7,     3,
+       9,     3,     4,    31,     7,   521,    84,    85,    86,    22,
+      38,     7,     7,   256,     9,   531,    85,    86,    77,     6,
+      29,    34,   205,   539,   207,    86,    56,     7,   349,    66,
+      67,    61,   383,     7,    29,   228,     0,   541,   511,   305,
+     298,    56,    57,    58,    59,    60,    79,    80,   521,    56,
+      90,    91,    92,    57,    56,    59,    60,    97,    98,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   427,   317,   115,   116,   123,   124,   371,
+     346,   402,   137,   121,   435,   123,   124,   142,   403,   214,
+     473,   173,    16,    48,   287,   296,    48,     3,    26,    27,
+      28,   141,     4,     5,     6,    31,     3,     4,     5,     6,
+       7,   444,    29,    30,    11,    71,    72,    73,    30,    74,
+      75,    10,    74,    75,    44,    45,    46,    24,   168,   211,
+     326,    71,   398,    73,   174,    32,     8,    39,    40,    41,
+      42,     3,    39,    40,    41,    42,   412,    71,   414,    73,
+      56,   191,    76,     3,   508,    23,    53,    34,    82,    56,
+      57,    58,    59,    60,    48,    62,    63,    64,    65,    66,
+      67,    68,    69,    70,   214,   215,    33,   217,    45,    46,
+     513,    43,    44,    45,    46,    48,   452,    53,     3,     4,
+     230,    74,    75,   117,    56,    57,    58,    59,    60,   400,
+      48,     7,   242,     7,   128,     7,   130,   131,   132,     7,
+     134,     8,   294,    49,   480,    30,   256,    53,    54,   485,
+      56,    30,    23,   147,   148,   149,   150,   470,   310,     8,
+      30,    46,    48,   273,    63,   501,    28,     8,    10,     7,
+       3,    56,    57,    58,    59,    60,    23,    30,   172,   173,
+      30,    46,    30,     3,    30,    30,     8,     7,   298,    33,
+       3,     4,   344,    48,    31,    31,   306,   307,   308,   535,
+       3,    31,   312,   313,   314,   315,    30,   317,    31,    48,
+       7,    44,     4,    48,   208,     8,    10,   211,   328,     8,
+     491,   331,   216,    56,    57,    58,    59,    60,    23,   223,
+      50,   341,    48,    46,    48,   229,    56,    57,    58,    59,
+      60,    44,   394,    56,    57,    58,    59,    60,    48,    30,
+     521,    59,     8,    56,    57,    58,    59,    60,    54,    31,
+     531,    31,    66,    65,     8,   259,   260,   261,   539,    67,
+       8,    33,   424,   267,    24,    25,    26,    27,    28,    84,
+       8,     3,    48,    31,   436,     7,    61,     3,    30,     8,
+      48,   443,     7,    76,    85,   289,    30,    56,    30,    12,
+     294,    48,    33,    77,    33,   415,   416,   417,   418,     3,
+     420,     5,     6,     7,   466,    48,   310,   427,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    56,    57,    58,    59,    60,   449,
+      56,    57,    58,    59,    60,    39,    40,    41,    42,   459,
+     344,   461,    64,     3,     8,     5,     6,     7,    48,    53,
+     470,    86,    56,    57,    58,    59,    60,    70,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,   371,     7,   373,
+      48,     3,   376,    31,   378,     7,    81,    82,    83,    39,
+      40,    41,    42,    68,   388,    69,     8,     8,   508,    34,
+     394,   511,    33,    53,    77,   400,    56,    57,    58,    59,
+      60,   521,    62,    63,    64,    65,    66,    67,    68,    69,
+      70,    59,   121,   124,   515,     0,   310,   435,   324,   147,
+     424,    70,   286,   285,    56,    57,    58,    59,    60,   229,
+       0,   229,   436,   336,   211,   142,   289,   476,   277,   443,
+       1,   443,     3,     4,     5,     6,     7,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+     477,   462,   466,    24,    -1,   339,    -1,   466,    -1,   473,
+      31,    32,   476,   477,    -1,   267,    -1,    38,    39,    40,
+      41,    42,   319,    -1,    -1,    -1,    47,    -1,    -1,    -1,
+      51,    52,    53,    -1,    -1,    56,    57,    58,    59,    60,
+      -1,    62,    63,    64,    65,    66,    67,    68,    69,    70,
+      -1,    -1,   516,     3,     4,     5,     6,     7,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   536,    -1,    24,    -1,    -1,    -1,    -1,    -1,
+      -1,    31,    32,    -1,    -1,    -1,    -1,    -1,    -1,    39,
+      40,    41,    42,    -1,    -1,    -1,    -1,    47,    -1,    -1,
+      -1,    51,    52,    53,    -1,    55,    56,    57,    58,    59,
+      60,    -1,    62,    63,    64,    65,    66,    67,    68,    69,
+      70,     3,     4,     5,     6,     7,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    24,    30,    -1,    -1,    33,    -1,    -1,    31,
+      32,    -1,    -1,    -1,    -1,    -1,    -1,    39,    40,    41,
+      42,    -1,    -1,    -1,    -1,    47,    -1,    -1,    -1,    51,
+      52,    53,    -1,    55,    56,    57,    58,    59,    60,    -1,
+      62,    63,    64,    65,    66,    67,    68,    69,    70,     3,
+       4,     5,     6,     7,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+      24,    -1,    -1,    -1,    33,    -1,    -1,    31,    32,    -1,
+      -1,    -1,    -1,    -1,    -1,    39,    40,    41,    42,    -1,
+      -1,    -1,    -1,    47,    -1,    -1,    -1,    51,    52,    53,
+      -1,    -1,    56,    57,    58,    59,    60,    -1,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,     3,     4,     5,
+       6,     7,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,    22,    23,    24,    25,    26,    27,    28,    24,    -1,
+      31,    -1,    -1,    -1,    -1,    31,    32,    -1,    -1,    -1,
+      -1,    -1,    -1,    39,    40,    41,    42,    -1,    -1,    -1,
+      -1,    47,    -1,    -1,    -1,    51,    52,    53,    -1,    -1,
+      56,    57,    58,    59,    60,    -1,    62,    63,    64,    65,
+      66,    67,    68,    69,    70,     3,     4,     5,     6,     7,
+      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
+      23,    24,    25,    26,    27,    28,    24,    30,    -1,    -1,
+      -1,    -1,    -1,    -1,    32,    -1,    -1,    -1,    -1,    -1,
+      -1,    39,    40,    41,    42,    -1,    -1,    -1,    -1,    47,
+      -1,    -1,    -1,    51,    52,    53,    -1,    -1,    56,    57,
+      58,    59,    60,    -1,    62,    63,    64,    65,    66,    67,
+      68,    69,    70,     3,     4,     5,     6,     7,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    24,    30,    -1,    -1,    -1,    -1,
+      -1,    -1,    32,    -1,    -1,    -1,    -1,    -1,    -1,    39,
+      40,    41,    42,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    53,    -1,    55,    56,    57,    58,    59,
+      60,    -1,    62,    63,    64,    65,    66,    67,    68,    69,
+      70,     3,     4,     5,     6,     7,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    24,    30,    -1,    -1,    -1,    -1,    -1,    -1,
+      32,    -1,    -1,    -1,    -1,    -1,    -1,    39,    40,    41,
+      42,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    53,    -1,    55,    56,    57,    58,    59,    60,    -1,
+      62,    63,    64,    65,    66,    67,    68,    69,    70,     3,
+       4,     5,     6,     7,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+      24,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    32,    -1,
+      -1,    -1,    -1,    -1,    -1,    39,    40,    41,    42,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    53,
+      -1,    -1,    56,    57,    58,    59,    60,    -1,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,     3,     4,     5,
+       6,     7,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,    22,    23,    24,    25,    26,    27,    28,    24,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    32,    -1,    -1,    -1,
+      -1,    -1,    -1,    39,    40,    41,    42,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    53,    -1,    -1,
+      56,    57,    58,    59,    60,    -1,    62,    63,    64,    65,
+      66,    67,    68,    69,    70,    -1,    -1,    78,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,     8,    -1,    -1,    -1,    -1,    13,
+      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,     8,    30,    -1,    -1,    -1,
+      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
+      23,    24,    25,    26,    27,    28,    -1,     8,    -1,    -1,
+      -1,    76,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,    22,    23,    24,    25,    26,    27,    28,     8,    -1,
+      -1,    -1,    -1,    13,    14,    15,    16,    17,    18,    19,
+      20,    21,    22,    23,    24,    25,    26,    27,    28,     8,
+      -1,    -1,    -1,    -1,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+       8,    -1,    -1,    -1,    -1,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,     8,    -1,    -1,    -1,    -1,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_uint8 yystos[] =
+{
+       0,     1,     3,     4,     5,     6,     7,    24,    31,    32,
+      38,    39,    40,    41,    42,    47,    51,    52,    53,    56,
+      57,    58,    59,    60,    62,    63,    64,    65,    66,    67,
+      68,    69,    70,    88,    89,    96,    97,    98,    99,   100,
+     103,   104,   105,   106,   111,   112,   114,   119,   120,   127,
+     137,   138,   139,   150,   165,   197,   207,    31,    38,     6,
+     107,    96,     4,   105,   108,   110,   226,   109,   110,   227,
+       3,    57,    59,    60,   182,   230,     7,    50,   203,   206,
+     207,   198,     7,   186,   113,    55,    96,   121,   126,   115,
+       7,     7,     7,   151,   140,   128,     0,    13,    14,    15,
+      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
+      26,    27,    28,    31,   100,     7,     9,    29,    31,   107,
+       8,    30,    10,    29,    30,     8,   182,   203,   167,   203,
+      49,    53,    54,    56,    44,   204,   206,     7,   101,   104,
+     199,    23,    34,   209,   234,    53,   201,   218,    43,    44,
+      45,    46,   189,   190,   191,   192,   193,   207,   231,    48,
+      90,    91,    92,    33,   217,    33,    48,   122,     7,    96,
+      96,    96,     7,     7,     7,    96,    96,    96,    96,    96,
+      96,    96,    96,    96,    96,    96,    96,    96,    96,    96,
+      96,     4,    96,   102,   225,   225,   207,   108,   110,   109,
+     176,   207,   175,   207,   173,   207,   174,   207,   166,   207,
+       8,    30,   100,   210,     7,     9,    29,    23,    96,   210,
+     173,   207,   207,     4,    30,    46,   194,   195,   207,    30,
+      22,   234,     8,   218,    48,    93,    95,    96,   165,   197,
+      63,   159,    31,    95,   123,    96,     8,     8,     8,   207,
+     143,   144,   145,   206,    96,    96,    30,     8,    10,    71,
+      72,    73,   177,   178,   179,   180,   181,     7,   188,   186,
+     186,   168,   207,    23,   204,    30,   211,   212,   232,   225,
+     102,   207,    96,   200,    30,    30,    30,   207,    46,    30,
+     234,   190,   193,    96,    33,   187,    31,   126,    31,    31,
+     222,     8,    90,    90,    90,     8,     4,    66,    67,   148,
+      30,   223,    23,    79,    80,    76,   130,    30,   102,   207,
+     185,   207,   185,    48,    31,   231,    48,    48,     7,   183,
+      96,     4,   211,     8,     8,    10,   202,   191,   192,   234,
+     194,    23,   196,   228,     7,   206,   222,    94,    95,   124,
+      96,   123,   126,    91,   117,    48,    48,    48,    90,    96,
+      96,    96,   141,   143,    96,    96,    96,    96,   129,   102,
+     232,    30,    59,   221,   177,     8,   218,    54,   219,    96,
+     184,   229,     3,    56,   169,   170,   171,   172,    11,    96,
+     213,   201,   228,    96,    44,   205,   206,   235,    31,    90,
+      31,   123,   125,    74,    75,   118,    65,   158,    66,   162,
+      67,   161,    84,   153,     8,    78,    81,    82,    83,   146,
+       8,   185,   207,   208,    33,   208,   208,    30,     8,     3,
+       4,   171,     3,   171,    48,    31,    61,   207,   214,   215,
+     216,   233,   206,    30,     8,    90,    94,   123,    91,     7,
+     116,    90,    85,   154,    90,    96,    96,    96,    96,    76,
+     147,     7,    55,   131,   136,   184,     7,   206,   184,     4,
+      30,   224,    56,   220,   169,   206,    30,    33,    12,   205,
+     222,    96,    48,    90,   155,    77,   149,    96,    96,   217,
+      48,   132,    33,   235,   224,   102,   208,   224,   214,   216,
+      90,     8,    64,   157,    86,   152,    90,    48,    30,    70,
+     160,    31,    95,   133,     8,    90,     7,    48,   142,   184,
+     136,    31,   222,   118,   156,   207,    68,   164,    69,   163,
+       8,   134,    96,   133,   136,     8,    34,    33,   133,   135,
+      90,   207,   133,   224
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_uint8 yyr1[] =
+{
+       0,    87,    88,    88,    88,    88,    88,    89,    89,    89,
+      89,    89,    89,    89,    90,    90,    92,    91,    93,    93,
+      94,    94,    94,    95,    95,    95,    96,    96,    96,    96,
+      96,    96,    96,    96,    96,    96,    96,    96,    96,    96,
+      96,    96,    96,    97,    97,    98,    98,    99,    99,   100,
+     100,   100,   100,   101,   101,   101,   101,   102,   102,   102,
+     102,   103,   103,   104,   104,   104,   104,   105,   105,   105,
+     105,   105,   105,   106,   106,   107,   107,   108,   108,   109,
+     109,   109,   110,   110,   111,   111,   111,   111,   111,   111,
+     111,   111,   111,   113,   112,   115,   116,   114,   117,   117,
+     118,   118,   118,   118,   119,   120,   121,   122,   121,   123,
+     123,   124,   123,   123,   123,   125,   123,   126,   126,   128,
+     129,   127,   130,   130,   131,   132,   131,   133,   133,   134,
+     133,   133,   133,   135,   133,   136,   136,   136,   137,   138,
+     140,   141,   142,   139,   143,   143,   144,   144,   145,   145,
+     145,   146,   146,   146,   146,   147,   147,   148,   148,   148,
+     148,   149,   149,   151,   152,   150,   153,   153,   154,   154,
+     155,   155,   156,   156,   157,   157,   158,   158,   159,   159,
+     160,   160,   161,   161,   162,   162,   163,   163,   164,   164,
+     165,   165,   165,   165,   165,   166,   165,   167,   165,   168,
+     169,   169,   169,   170,   170,   171,   171,   171,   172,   172,
+     173,   174,   175,   176,   177,   177,   178,   178,   178,   179,
+     180,   181,   182,   182,   183,   184,   184,   185,   185,   187,
+     186,   186,   186,   188,   188,   188,   189,   189,   189,   189,
+     190,   190,   190,   191,   191,   191,   192,   192,   192,   192,
+     193,   193,   194,   194,   194,   195,   195,   196,   197,   197,
+     198,   197,   199,   199,   200,   201,   202,   201,   203,   203,
+     204,   204,   204,   205,   205,   205,   206,   207,   207,   208,
+     208,   209,   210,   211,   211,   212,   213,   213,   214,   214,
+     215,   215,   216,   217,   217,   218,   218,   219,   219,   220,
+     220,   221,   221,   222,   222,   223,   223,   224,   224,   225,
+     225,   226,   226,   227,   227,   228,   228,   229,   229,   230,
+     230,   231,   231,   232,   232,   233,   233,   234,   234,   235,
+     235
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     1,     1,     1,     1,     1,     2,     2,
+       1,     1,     2,     2,     0,     1,     0,     2,     1,     3,
+       0,     1,     3,     1,     1,     1,     1,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     1,     1,     1,     2,     1,     1,     4,
+       4,     3,     1,     4,     4,     3,     1,     2,     1,     4,
+       3,     3,     1,     1,     1,     4,     1,     1,     1,     1,
+       1,     3,     3,     1,     2,     1,     2,     1,     3,     1,
+       3,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     0,     4,     0,     0,    10,     0,     1,
+       0,     1,     2,     6,     7,     4,     0,     0,     4,     0,
+       1,     0,     4,     1,     3,     0,     5,     2,     2,     0,
+       0,    10,     0,     2,     0,     0,     4,     0,     1,     0,
+       4,     1,     3,     0,     5,     2,     6,     2,     7,     7,
+       0,     0,     0,    12,     2,     3,     0,     1,     5,     3,
+       5,     0,     2,     2,     2,     0,     2,     0,     2,     2,
+       2,     0,     2,     0,     0,    12,     0,     2,     0,     2,
+       0,     6,     1,     4,     0,     1,     0,     1,     0,     1,
+       0,     1,     0,     1,     0,     1,     0,     1,     0,     1,
+       4,     4,     4,     3,     3,     0,     5,     0,     4,     6,
+       0,     1,     3,     1,     4,     0,     2,     2,     3,     4,
+       5,     5,     2,     5,     0,     3,     1,     1,     1,     3,
+       2,     2,     1,     2,     3,     1,     3,     1,     3,     0,
+       6,     7,     9,     3,     5,     7,     1,     3,     3,     1,
+       2,     4,     1,     2,     4,     1,     1,     3,     2,     1,
+       2,     3,     1,     1,     3,     4,     3,     2,     2,     5,
+       0,     3,     1,     4,     1,     2,     0,     5,     3,     5,
+       1,     3,     2,     1,     3,     2,     2,     1,     1,     0,
+       1,     2,     1,     1,     2,     3,     1,     3,     1,     3,
+       1,     3,     1,     0,     1,     0,     1,     0,     1,     0,
+       1,     0,     1,     0,     1,     0,     1,     0,     2,     0,
+       1,     0,     1,     0,     1,     0,     1,     0,     1,     0,
+       1,     0,     1,     0,     1,     0,     1,     0,     1,     0,
+       1
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 7: /* evaluable_constituent: ';'  */
+#line 175 "dylan.y"
+                { *parse_value_ptr = unspecified_object; YYACCEPT; }
+#line 1992 "dylan.tab.c"
+    break;
+
+  case 8: /* evaluable_constituent: defining_form ';'  */
+#line 178 "dylan.y"
+                { *parse_value_ptr = yyvsp[-1]; YYACCEPT; }
+#line 1998 "dylan.tab.c"
+    break;
+
+  case 9: /* evaluable_constituent: expression ';'  */
+#line 181 "dylan.y"
+                { *parse_value_ptr = yyvsp[-1]; YYACCEPT; }
+#line 2004 "dylan.tab.c"
+    break;
+
+  case 10: /* evaluable_constituent: local_declaration  */
+#line 184 "dylan.y"
+                { *parse_value_ptr = unspecified_object;
+		  marlais_warning("local binding outside of block ignored", NULL);
+		  YYACCEPT;
+	        }
+#line 2013 "dylan.tab.c"
+    break;
+
+  case 11: /* evaluable_constituent: EOF_TOKEN  */
+#line 193 "dylan.y"
+                        { *parse_value_ptr = eof_object; YYACCEPT; }
+#line 2019 "dylan.tab.c"
+    break;
+
+  case 12: /* evaluable_constituent: error ';'  */
+#line 196 "dylan.y"
+                { yyerrok;
+		  *parse_value_ptr = unspecified_object;
+		  YYACCEPT;
+		}
+#line 2028 "dylan.tab.c"
+    break;
+
+  case 13: /* evaluable_constituent: error EOF_TOKEN  */
+#line 201 "dylan.y"
+                { yyerrok;
+		  *parse_value_ptr = eof_object;
+		  YYACCEPT;
+		}
+#line 2037 "dylan.tab.c"
+    break;
+
+  case 14: /* body: %empty  */
+#line 207 "dylan.y"
+                        { yyval = unspecified_object; }
+#line 2043 "dylan.tab.c"
+    break;
+
+  case 15: /* body: nonempty_body  */
+#line 208 "dylan.y"
+                        { yyval = yyvsp[0]; }
+#line 2049 "dylan.tab.c"
+    break;
+
+  case 16: /* $@1: %empty  */
+#line 211 "dylan.y"
+                { push_bindings (); }
+#line 2055 "dylan.tab.c"
+    break;
+
+  case 17: /* nonempty_body: $@1 nonempty_constituents  */
+#line 215 "dylan.y"
+          {
+	   if (INTVAL (bindings_top ()) > 0) {
+	       yyval = cons(unbinding_begin_symbol,
+			 cons (bindings_top(), yyvsp[0]));
+	   } else if (list_length (yyvsp[0]) > 1) {
+	       yyval = cons (begin_symbol, yyvsp[0]);
+	   } else {
+	       yyval = FIRST (yyvsp[0]);
+	   }
+	   pop_bindings ();
+	}
+#line 2071 "dylan.tab.c"
+    break;
+
+  case 18: /* nonempty_constituents: constituent  */
+#line 229 "dylan.y"
+                                        { yyval = cons (yyvsp[0], make_empty_list()); }
+#line 2077 "dylan.tab.c"
+    break;
+
+  case 19: /* nonempty_constituents: constituent ';' constituents  */
+#line 230 "dylan.y"
+                                        { yyval = cons (yyvsp[-2], yyvsp[0]); }
+#line 2083 "dylan.tab.c"
+    break;
+
+  case 20: /* constituents: %empty  */
+#line 233 "dylan.y"
+                                        { yyval = make_empty_list(); }
+#line 2089 "dylan.tab.c"
+    break;
+
+  case 21: /* constituents: constituent  */
+#line 234 "dylan.y"
+                                        { yyval = cons (yyvsp[0], make_empty_list()); }
+#line 2095 "dylan.tab.c"
+    break;
+
+  case 22: /* constituents: constituent ';' constituents  */
+#line 235 "dylan.y"
+                                        { yyval = cons (yyvsp[-2], yyvsp[0]); }
+#line 2101 "dylan.tab.c"
+    break;
+
+  case 23: /* constituent: defining_form  */
+#line 242 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 2107 "dylan.tab.c"
+    break;
+
+  case 24: /* constituent: local_declaration  */
+#line 243 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 2113 "dylan.tab.c"
+    break;
+
+  case 25: /* constituent: expression  */
+#line 244 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 2119 "dylan.tab.c"
+    break;
+
+  case 26: /* expression: binary_operand  */
+#line 252 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 2125 "dylan.tab.c"
+    break;
+
+  case 27: /* expression: expression COLON_EQUAL expression  */
+#line 255 "dylan.y"
+           { if (SYMBOLP ( yyvsp[-2])) {
+		 yyval = listem (set_bang_symbol, yyvsp[-2], yyvsp[0], NULL);
+	     } else {
+		 yyval = make_setter_expr (yyvsp[-2], yyvsp[0]);
+	     }
+	   }
+#line 2136 "dylan.tab.c"
+    break;
+
+  case 28: /* expression: expression '&' expression  */
+#line 262 "dylan.y"
+                { yyval = listem (yyvsp[-1], yyvsp[-2], yyvsp[0], NULL); }
+#line 2142 "dylan.tab.c"
+    break;
+
+  case 29: /* expression: expression '|' expression  */
+#line 264 "dylan.y"
+                { yyval = listem (yyvsp[-1], yyvsp[-2], yyvsp[0], NULL); }
+#line 2148 "dylan.tab.c"
+    break;
+
+  case 30: /* expression: expression GREATER_EQUAL expression  */
+#line 266 "dylan.y"
+                { yyval = listem (yyvsp[-1], yyvsp[-2], yyvsp[0], NULL); }
+#line 2154 "dylan.tab.c"
+    break;
+
+  case 31: /* expression: expression LESSER_EQUAL expression  */
+#line 268 "dylan.y"
+                { yyval = listem (yyvsp[-1], yyvsp[-2], yyvsp[0], NULL); }
+#line 2160 "dylan.tab.c"
+    break;
+
+  case 32: /* expression: expression '<' expression  */
+#line 270 "dylan.y"
+                { yyval = listem (yyvsp[-1], yyvsp[-2], yyvsp[0], NULL); }
+#line 2166 "dylan.tab.c"
+    break;
+
+  case 33: /* expression: expression '>' expression  */
+#line 272 "dylan.y"
+                { yyval = listem (yyvsp[-1], yyvsp[-2], yyvsp[0], NULL); }
+#line 2172 "dylan.tab.c"
+    break;
+
+  case 34: /* expression: expression NOT_EQUAL expression  */
+#line 274 "dylan.y"
+                { yyval = listem (yyvsp[-1], yyvsp[-2], yyvsp[0], NULL); }
+#line 2178 "dylan.tab.c"
+    break;
+
+  case 35: /* expression: expression NOT_EQUAL_EQUAL expression  */
+#line 276 "dylan.y"
+                { yyval = listem (yyvsp[-1], yyvsp[-2], yyvsp[0], NULL); }
+#line 2184 "dylan.tab.c"
+    break;
+
+  case 36: /* expression: expression EQUAL_EQUAL expression  */
+#line 278 "dylan.y"
+                { yyval = listem (yyvsp[-1], yyvsp[-2], yyvsp[0], NULL); }
+#line 2190 "dylan.tab.c"
+    break;
+
+  case 37: /* expression: expression '=' expression  */
+#line 280 "dylan.y"
+                { yyval = listem (yyvsp[-1], yyvsp[-2], yyvsp[0], NULL); }
+#line 2196 "dylan.tab.c"
+    break;
+
+  case 38: /* expression: expression '-' expression  */
+#line 282 "dylan.y"
+                { yyval = listem (yyvsp[-1], yyvsp[-2], yyvsp[0], NULL); }
+#line 2202 "dylan.tab.c"
+    break;
+
+  case 39: /* expression: expression '+' expression  */
+#line 284 "dylan.y"
+                { yyval = listem (yyvsp[-1], yyvsp[-2], yyvsp[0], NULL); }
+#line 2208 "dylan.tab.c"
+    break;
+
+  case 40: /* expression: expression '/' expression  */
+#line 286 "dylan.y"
+                { yyval = listem (yyvsp[-1], yyvsp[-2], yyvsp[0], NULL); }
+#line 2214 "dylan.tab.c"
+    break;
+
+  case 41: /* expression: expression '*' expression  */
+#line 288 "dylan.y"
+                { yyval = listem (yyvsp[-1], yyvsp[-2], yyvsp[0], NULL); }
+#line 2220 "dylan.tab.c"
+    break;
+
+  case 42: /* expression: expression '^' expression  */
+#line 290 "dylan.y"
+                { yyval = listem (yyvsp[-1], yyvsp[-2], yyvsp[0], NULL); }
+#line 2226 "dylan.tab.c"
+    break;
+
+  case 43: /* binary_operand: KEYWORD  */
+#line 297 "dylan.y"
+                                        { yyval = yyvsp[0]; }
+#line 2232 "dylan.tab.c"
+    break;
+
+  case 44: /* binary_operand: keyless_binary_operand  */
+#line 298 "dylan.y"
+                                        { yyval = yyvsp[0]; }
+#line 2238 "dylan.tab.c"
+    break;
+
+  case 45: /* keyless_binary_operand: operand  */
+#line 301 "dylan.y"
+                                        { yyval = yyvsp[0]; }
+#line 2244 "dylan.tab.c"
+    break;
+
+  case 46: /* keyless_binary_operand: unary_operator operand  */
+#line 303 "dylan.y"
+                { yyval = cons (yyvsp[-1], cons (yyvsp[0], make_empty_list())); }
+#line 2250 "dylan.tab.c"
+    break;
+
+  case 47: /* unary_operator: '-'  */
+#line 306 "dylan.y"
+                                        { yyval = negative_symbol; }
+#line 2256 "dylan.tab.c"
+    break;
+
+  case 48: /* unary_operator: '~'  */
+#line 307 "dylan.y"
+                                        { yyval = yyvsp[0]; }
+#line 2262 "dylan.tab.c"
+    break;
+
+  case 49: /* operand: operand '(' arguments_opt ')'  */
+#line 311 "dylan.y"
+          {
+#ifdef OPTIMIZE_SPECIALIZERS
+	      yyval = cons (yyvsp[-3], yyvsp[-1]);
+#else
+	      yyval = cons (yyvsp[-3], yyvsp[-1]);
+#endif
+	  }
+#line 2274 "dylan.tab.c"
+    break;
+
+  case 50: /* operand: operand '[' arguments_opt ']'  */
+#line 319 "dylan.y"
+                { if (list_length (yyvsp[-1]) == 1) {
+			yyval = cons (element_symbol, cons (yyvsp[-3], yyvsp[-1]));
+		  } else {
+			yyval = cons (aref_symbol, cons (yyvsp[-3], yyvsp[-1]));
+		  }
+		}
+#line 2285 "dylan.tab.c"
+    break;
+
+  case 51: /* operand: operand '.' variable_name  */
+#line 326 "dylan.y"
+                { yyval = cons (yyvsp[0], cons (yyvsp[-2], make_empty_list())); }
+#line 2291 "dylan.tab.c"
+    break;
+
+  case 52: /* operand: leaf  */
+#line 327 "dylan.y"
+                                        { yyval = yyvsp[0]; }
+#line 2297 "dylan.tab.c"
+    break;
+
+  case 53: /* unparenthesized_operand: unparenthesized_operand '(' arguments_opt ')'  */
+#line 331 "dylan.y"
+                {
+#ifdef OPTIMIZE_SPECIALIZERS
+		    yyval = cons (yyvsp[-3], yyvsp[-1]);
+#else
+		    yyval = cons (yyvsp[-3], yyvsp[-1]);
+#endif
+		}
+#line 2309 "dylan.tab.c"
+    break;
+
+  case 54: /* unparenthesized_operand: unparenthesized_operand '[' arguments ']'  */
+#line 339 "dylan.y"
+                { yyval = cons (element_symbol, cons (yyvsp[-3], yyvsp[-1])); }
+#line 2315 "dylan.tab.c"
+    break;
+
+  case 55: /* unparenthesized_operand: unparenthesized_operand '.' variable_name  */
+#line 341 "dylan.y"
+                { yyval = cons (yyvsp[0], cons (yyvsp[-2], make_empty_list())); }
+#line 2321 "dylan.tab.c"
+    break;
+
+  case 56: /* unparenthesized_operand: unparenthesized_leaf  */
+#line 342 "dylan.y"
+                                        { yyval = yyvsp[0]; }
+#line 2327 "dylan.tab.c"
+    break;
+
+  case 57: /* arguments: KEYWORD expression  */
+#line 345 "dylan.y"
+                                        { yyval = listem (yyvsp[-1], yyvsp[0], NULL); }
+#line 2333 "dylan.tab.c"
+    break;
+
+  case 58: /* arguments: expression  */
+#line 346 "dylan.y"
+                                { yyval = cons (yyvsp[0], make_empty_list()); }
+#line 2339 "dylan.tab.c"
+    break;
+
+  case 59: /* arguments: KEYWORD expression ',' arguments  */
+#line 348 "dylan.y"
+                { yyval = cons (yyvsp[-3], cons (yyvsp[-2], yyvsp[0])); }
+#line 2345 "dylan.tab.c"
+    break;
+
+  case 60: /* arguments: expression ',' arguments  */
+#line 350 "dylan.y"
+                { yyval = cons (yyvsp[-2], yyvsp[0]); }
+#line 2351 "dylan.tab.c"
+    break;
+
+  case 61: /* leaf: '(' expression ')'  */
+#line 352 "dylan.y"
+                                        { yyval = yyvsp[-1]; }
+#line 2357 "dylan.tab.c"
+    break;
+
+  case 62: /* leaf: unparenthesized_leaf  */
+#line 353 "dylan.y"
+                                        { yyval = yyvsp[0]; }
+#line 2363 "dylan.tab.c"
+    break;
+
+  case 63: /* unparenthesized_leaf: literal  */
+#line 356 "dylan.y"
+                                        { yyval = yyvsp[0]; }
+#line 2369 "dylan.tab.c"
+    break;
+
+  case 64: /* unparenthesized_leaf: variable_name  */
+#line 357 "dylan.y"
+                                        { yyval = yyvsp[0]; }
+#line 2375 "dylan.tab.c"
+    break;
+
+  case 65: /* unparenthesized_leaf: METHOD method_body END METHOD_opt  */
+#line 359 "dylan.y"
+                { yyval = cons (yyvsp[-3], yyvsp[-2]); }
+#line 2381 "dylan.tab.c"
+    break;
+
+  case 66: /* unparenthesized_leaf: statement  */
+#line 360 "dylan.y"
+                                        { yyval = yyvsp[0]; }
+#line 2387 "dylan.tab.c"
+    break;
+
+  case 67: /* literal: LITERAL  */
+#line 362 "dylan.y"
+                                                { yyval = yyvsp[0]; }
+#line 2393 "dylan.tab.c"
+    break;
+
+  case 68: /* literal: strings  */
+#line 363 "dylan.y"
+                                                { yyval = yyvsp[0]; }
+#line 2399 "dylan.tab.c"
+    break;
+
+  case 69: /* literal: HASH_T  */
+#line 364 "dylan.y"
+                                                { yyval = yyvsp[0]; }
+#line 2405 "dylan.tab.c"
+    break;
+
+  case 70: /* literal: HASH_F  */
+#line 365 "dylan.y"
+                                                { yyval = yyvsp[0]; }
+#line 2411 "dylan.tab.c"
+    break;
+
+  case 71: /* literal: HASH_PAREN list_constants_opt ')'  */
+#line 367 "dylan.y"
+                { yyval = yyvsp[-1]; }
+#line 2417 "dylan.tab.c"
+    break;
+
+  case 72: /* literal: HASH_BRACKET constants_opt ']'  */
+#line 369 "dylan.y"
+                { yyval = marlais_make_sov (yyvsp[-1]); }
+#line 2423 "dylan.tab.c"
+    break;
+
+  case 73: /* strings: STRING  */
+#line 371 "dylan.y"
+                            { yyval = yyvsp[0]; }
+#line 2429 "dylan.tab.c"
+    break;
+
+  case 74: /* strings: STRING component_strings  */
+#line 373 "dylan.y"
+                { yyval = cons (concatenate_symbol, cons (yyvsp[-1], yyvsp[0])); }
+#line 2435 "dylan.tab.c"
+    break;
+
+  case 75: /* component_strings: STRING  */
+#line 376 "dylan.y"
+                        { yyval = cons (yyvsp[0], make_empty_list()); }
+#line 2441 "dylan.tab.c"
+    break;
+
+  case 76: /* component_strings: STRING component_strings  */
+#line 378 "dylan.y"
+                { yyval = cons (yyvsp[-1], yyvsp[0]); }
+#line 2447 "dylan.tab.c"
+    break;
+
+  case 77: /* constants: constant  */
+#line 380 "dylan.y"
+                                        { yyval = cons (yyvsp[0], make_empty_list()); }
+#line 2453 "dylan.tab.c"
+    break;
+
+  case 78: /* constants: constant ',' constants  */
+#line 381 "dylan.y"
+                                        { yyval = cons (yyvsp[-2], yyvsp[0]); }
+#line 2459 "dylan.tab.c"
+    break;
+
+  case 79: /* list_constants: constant  */
+#line 384 "dylan.y"
+                                        { yyval = listem (pair_symbol,
+						       yyvsp[0],
+						       make_empty_list(),
+						       NULL);
+					}
+#line 2469 "dylan.tab.c"
+    break;
+
+  case 80: /* list_constants: constant '.' constant  */
+#line 389 "dylan.y"
+                                        { yyval = listem (pair_symbol, yyvsp[-2], yyvsp[0], NULL);
+					}
+#line 2476 "dylan.tab.c"
+    break;
+
+  case 81: /* list_constants: constant ',' list_constants  */
+#line 391 "dylan.y"
+                                        { yyval = listem (pair_symbol, yyvsp[-2], yyvsp[0], NULL);
+					}
+#line 2483 "dylan.tab.c"
+    break;
+
+  case 82: /* constant: literal  */
+#line 395 "dylan.y"
+                                        { yyval = yyvsp[0]; }
+#line 2489 "dylan.tab.c"
+    break;
+
+  case 83: /* constant: KEYWORD  */
+#line 396 "dylan.y"
+                                        { yyval = yyvsp[0]; }
+#line 2495 "dylan.tab.c"
+    break;
+
+  case 84: /* statement: begin_statement  */
+#line 402 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 2501 "dylan.tab.c"
+    break;
+
+  case 85: /* statement: if_statement  */
+#line 403 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 2507 "dylan.tab.c"
+    break;
+
+  case 86: /* statement: unless_statement  */
+#line 404 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 2513 "dylan.tab.c"
+    break;
+
+  case 87: /* statement: case_statement  */
+#line 405 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 2519 "dylan.tab.c"
+    break;
+
+  case 88: /* statement: select_statement  */
+#line 406 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 2525 "dylan.tab.c"
+    break;
+
+  case 89: /* statement: while_statement  */
+#line 407 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 2531 "dylan.tab.c"
+    break;
+
+  case 90: /* statement: until_statement  */
+#line 408 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 2537 "dylan.tab.c"
+    break;
+
+  case 91: /* statement: for_statement  */
+#line 409 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 2543 "dylan.tab.c"
+    break;
+
+  case 92: /* statement: block_statement  */
+#line 410 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 2549 "dylan.tab.c"
+    break;
+
+  case 93: /* $@2: %empty  */
+#line 418 "dylan.y"
+                {
+#ifdef OPTIMIZE_SPECIALIZERS
+		    symtab_push_begin ();
+#endif
+		}
+#line 2559 "dylan.tab.c"
+    break;
+
+  case 94: /* begin_statement: BEGIN_TOKEN $@2 body END  */
+#line 424 "dylan.y"
+                {
+#ifdef OPTIMIZE_SPECIALIZERS
+		    symtab_pop ();
+#endif
+		    yyval = yyvsp[-1];
+		}
+#line 2570 "dylan.tab.c"
+    break;
+
+  case 95: /* $@3: %empty  */
+#line 433 "dylan.y"
+                        { push_intermediate_words (yyvsp[0]); }
+#line 2576 "dylan.tab.c"
+    break;
+
+  case 96: /* $@4: %empty  */
+#line 436 "dylan.y"
+                        { pop_intermediate_words (); }
+#line 2582 "dylan.tab.c"
+    break;
+
+  case 97: /* if_statement: IF $@3 '(' expression ')' then_body else_parts $@4 END IF_opt  */
+#line 438 "dylan.y"
+                        { yyval = cons (yyvsp[-9],
+				     cons (yyvsp[-6],
+					   append_bang (cons (yyvsp[-4],
+							      make_empty_list()),
+							yyvsp[-3]))); }
+#line 2592 "dylan.tab.c"
+    break;
+
+  case 98: /* then_body: %empty  */
+#line 445 "dylan.y"
+                        { yyval = MARLAIS_FALSE; }
+#line 2598 "dylan.tab.c"
+    break;
+
+  case 99: /* then_body: nonempty_body  */
+#line 446 "dylan.y"
+                        { yyval = yyvsp[0]; }
+#line 2604 "dylan.tab.c"
+    break;
+
+  case 100: /* else_parts: %empty  */
+#line 449 "dylan.y"
+                        { yyval = cons(MARLAIS_FALSE, make_empty_list()); }
+#line 2610 "dylan.tab.c"
+    break;
+
+  case 101: /* else_parts: ELSE  */
+#line 450 "dylan.y"
+                        { yyval = cons (MARLAIS_FALSE, make_empty_list()); }
+#line 2616 "dylan.tab.c"
+    break;
+
+  case 102: /* else_parts: ELSE nonempty_body  */
+#line 451 "dylan.y"
+                                { yyval = cons (yyvsp[0], make_empty_list()); }
+#line 2622 "dylan.tab.c"
+    break;
+
+  case 103: /* else_parts: ELSEIF '(' expression ')' body else_parts  */
+#line 453 "dylan.y"
+                        { yyval = cons (cons (if_symbol,
+					   cons (yyvsp[-3],
+						 append_bang (cons (yyvsp[-1],
+								    make_empty_list()),
+							      yyvsp[0]))),
+				     make_empty_list()); }
+#line 2633 "dylan.tab.c"
+    break;
+
+  case 104: /* unless_statement: UNLESS '(' expression ')' body END UNLESS_opt  */
+#line 463 "dylan.y"
+                { yyval = cons (yyvsp[-6], cons (yyvsp[-4], cons (yyvsp[-2], make_empty_list()))); }
+#line 2639 "dylan.tab.c"
+    break;
+
+  case 105: /* case_statement: CASE case_body END CASE_opt  */
+#line 469 "dylan.y"
+                { yyval = cons (cond_symbol, yyvsp[-2]); }
+#line 2645 "dylan.tab.c"
+    break;
+
+  case 106: /* case_body: %empty  */
+#line 472 "dylan.y"
+          { yyval = make_empty_list(); }
+#line 2651 "dylan.tab.c"
+    break;
+
+  case 107: /* $@5: %empty  */
+#line 474 "dylan.y"
+          { push_bindings (); }
+#line 2657 "dylan.tab.c"
+    break;
+
+  case 108: /* case_body: case_label $@5 case_tail SEMICOLON_opt  */
+#line 476 "dylan.y"
+          { yyval =  cons (cons (yyvsp[-3], !EMPTYLISTP (CAR (yyvsp[-1]))
+				  ? cons (cons (unbinding_begin_symbol,
+					        cons (bindings_top (),
+						      CAR (yyvsp[-1]))),
+				          make_empty_list())
+				  : make_empty_list()),
+		        CDR (yyvsp[-1]));
+          }
+#line 2670 "dylan.tab.c"
+    break;
+
+  case 109: /* case_tail: %empty  */
+#line 487 "dylan.y"
+                { yyval = cons (make_empty_list(), make_empty_list()); }
+#line 2676 "dylan.tab.c"
+    break;
+
+  case 110: /* case_tail: ';'  */
+#line 488 "dylan.y"
+                { yyval = cons (make_empty_list(), make_empty_list()); }
+#line 2682 "dylan.tab.c"
+    break;
+
+  case 111: /* $@6: %empty  */
+#line 490 "dylan.y"
+        { push_bindings (); }
+#line 2688 "dylan.tab.c"
+    break;
+
+  case 112: /* case_tail: ';' case_label $@6 case_tail  */
+#line 492 "dylan.y"
+        { yyval = cons (make_empty_list(),
+		     cons (cons (yyvsp[-2], !EMPTYLISTP (CAR (yyvsp[0]))
+				     ? cons (cons (unbinding_begin_symbol,
+					           cons (bindings_top(),
+							 CAR (yyvsp[0]))),
+				             make_empty_list())
+				     : make_empty_list()),
+		          CDR (yyvsp[0])));
+	  pop_bindings ();
+      }
+#line 2703 "dylan.tab.c"
+    break;
+
+  case 113: /* case_tail: constituent  */
+#line 504 "dylan.y"
+          { yyval = cons (cons (yyvsp[0], make_empty_list()), make_empty_list()); }
+#line 2709 "dylan.tab.c"
+    break;
+
+  case 114: /* case_tail: constituent ';' case_tail  */
+#line 507 "dylan.y"
+                {
+		 yyval = cons (cons (yyvsp[-2], FIRST (yyvsp[0])), CDR (yyvsp[0]));
+		}
+#line 2717 "dylan.tab.c"
+    break;
+
+  case 115: /* $@7: %empty  */
+#line 510 "dylan.y"
+                                     { push_bindings(); }
+#line 2723 "dylan.tab.c"
+    break;
+
+  case 116: /* case_tail: constituent ';' case_label $@7 case_tail  */
+#line 512 "dylan.y"
+        { yyval = cons (cons (yyvsp[-4], make_empty_list()),
+		     cons ( cons(yyvsp[-2], !EMPTYLISTP (CAR (yyvsp[0]))
+				     ? cons (cons (unbinding_begin_symbol,
+						   cons (bindings_top(),
+						         CAR (yyvsp[0]))),
+					     make_empty_list())
+				     : make_empty_list()),
+			   CDR (yyvsp[0])));
+		  pop_bindings ();
+	      }
+#line 2738 "dylan.tab.c"
+    break;
+
+  case 117: /* case_label: expression EQUAL_ARROW  */
+#line 528 "dylan.y"
+                { yyval = yyvsp[-1]; }
+#line 2744 "dylan.tab.c"
+    break;
+
+  case 118: /* case_label: OTHERWISE EQUAL_ARROW_opt  */
+#line 530 "dylan.y"
+                { yyval = else_keyword; }
+#line 2750 "dylan.tab.c"
+    break;
+
+  case 119: /* $@8: %empty  */
+#line 533 "dylan.y"
+                        { push_intermediate_words (yyvsp[0]); }
+#line 2756 "dylan.tab.c"
+    break;
+
+  case 120: /* $@9: %empty  */
+#line 535 "dylan.y"
+                        { pop_intermediate_words (); }
+#line 2762 "dylan.tab.c"
+    break;
+
+  case 121: /* select_statement: SELECT $@8 '(' expression test_opt $@9 ')' select_body END SELECT_opt  */
+#line 538 "dylan.y"
+                { yyval = cons (yyvsp[-9], cons (yyvsp[-6], cons (yyvsp[-5] ? yyvsp[-5] : equal_equal_symbol,
+						 yyvsp[-2]))); }
+#line 2769 "dylan.tab.c"
+    break;
+
+  case 122: /* test_opt: %empty  */
+#line 542 "dylan.y"
+                                { yyval = NULL; }
+#line 2775 "dylan.tab.c"
+    break;
+
+  case 123: /* test_opt: BY expression  */
+#line 543 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 2781 "dylan.tab.c"
+    break;
+
+  case 124: /* select_body: %empty  */
+#line 545 "dylan.y"
+           { yyval = make_empty_list(); }
+#line 2787 "dylan.tab.c"
+    break;
+
+  case 125: /* $@10: %empty  */
+#line 547 "dylan.y"
+          { push_bindings (); }
+#line 2793 "dylan.tab.c"
+    break;
+
+  case 126: /* select_body: select_label $@10 select_tail SEMICOLON_opt  */
+#line 549 "dylan.y"
+          { yyval =  cons (cons (yyvsp[-3], !EMPTYLISTP (CAR (yyvsp[-1]))
+				  ? cons (cons (unbinding_begin_symbol,
+						cons (bindings_top (),
+						      CAR (yyvsp[-1]))),
+				          make_empty_list())
+				  : make_empty_list()),
+		      CDR (yyvsp[-1]));
+          }
+#line 2806 "dylan.tab.c"
+    break;
+
+  case 127: /* select_tail: %empty  */
+#line 559 "dylan.y"
+                { yyval = cons (make_empty_list(), make_empty_list()); }
+#line 2812 "dylan.tab.c"
+    break;
+
+  case 128: /* select_tail: ';'  */
+#line 560 "dylan.y"
+                { yyval = cons (make_empty_list(), make_empty_list()); }
+#line 2818 "dylan.tab.c"
+    break;
+
+  case 129: /* $@11: %empty  */
+#line 562 "dylan.y"
+        { push_bindings (); }
+#line 2824 "dylan.tab.c"
+    break;
+
+  case 130: /* select_tail: ';' select_label $@11 select_tail  */
+#line 564 "dylan.y"
+        { yyval = cons (make_empty_list(),
+		     cons (cons (yyvsp[-2], !EMPTYLISTP (CAR (yyvsp[0]))
+				     ? cons (cons (unbinding_begin_symbol,
+					           cons (bindings_top(),
+							 CAR (yyvsp[0]))),
+				    	     make_empty_list())
+				     : make_empty_list()),
+		           CDR (yyvsp[0])));
+	  pop_bindings ();
+      }
+#line 2839 "dylan.tab.c"
+    break;
+
+  case 131: /* select_tail: constituent  */
+#line 576 "dylan.y"
+          { yyval = cons (cons (yyvsp[0], make_empty_list()), make_empty_list()); }
+#line 2845 "dylan.tab.c"
+    break;
+
+  case 132: /* select_tail: constituent ';' select_tail  */
+#line 579 "dylan.y"
+                {
+		 yyval = cons (cons (yyvsp[-2], FIRST (yyvsp[0])), CDR (yyvsp[0]));
+		}
+#line 2853 "dylan.tab.c"
+    break;
+
+  case 133: /* $@12: %empty  */
+#line 582 "dylan.y"
+                                       { push_bindings(); }
+#line 2859 "dylan.tab.c"
+    break;
+
+  case 134: /* select_tail: constituent ';' select_label $@12 select_tail  */
+#line 584 "dylan.y"
+        { yyval = cons (cons (yyvsp[-4], make_empty_list()),
+		     cons ( cons(yyvsp[-2], !EMPTYLISTP (CAR (yyvsp[0]))
+				     ? cons (cons (unbinding_begin_symbol,
+						   cons (bindings_top(),
+						         CAR (yyvsp[0]))),
+					     make_empty_list())
+				     : make_empty_list()),
+			   CDR (yyvsp[0])));
+		  pop_bindings ();
+	      }
+#line 2874 "dylan.tab.c"
+    break;
+
+  case 135: /* select_label: expressions EQUAL_ARROW  */
+#line 600 "dylan.y"
+                { yyval = yyvsp[-1]; }
+#line 2880 "dylan.tab.c"
+    break;
+
+  case 136: /* select_label: '(' expression ',' expressions ')' EQUAL_ARROW  */
+#line 602 "dylan.y"
+                {  yyval = cons (yyvsp[-4], yyvsp[-2]); }
+#line 2886 "dylan.tab.c"
+    break;
+
+  case 137: /* select_label: OTHERWISE EQUAL_ARROW_opt  */
+#line 604 "dylan.y"
+                { yyval = else_keyword; }
+#line 2892 "dylan.tab.c"
+    break;
+
+  case 138: /* while_statement: WHILE '(' expression ')' body END WHILE_opt  */
+#line 608 "dylan.y"
+                { yyval = cons (yyvsp[-6], cons (yyvsp[-4], cons (yyvsp[-2], make_empty_list()))); }
+#line 2898 "dylan.tab.c"
+    break;
+
+  case 139: /* until_statement: UNTIL '(' expression ')' body END UNTIL_opt  */
+#line 612 "dylan.y"
+                { yyval = cons (yyvsp[-6], cons (yyvsp[-4], cons (yyvsp[-2], make_empty_list()))); }
+#line 2904 "dylan.tab.c"
+    break;
+
+  case 140: /* $@13: %empty  */
+#line 615 "dylan.y"
+                        { push_intermediate_words (yyvsp[0]); }
+#line 2910 "dylan.tab.c"
+    break;
+
+  case 141: /* $@14: %empty  */
+#line 618 "dylan.y"
+                        { pop_intermediate_words (); }
+#line 2916 "dylan.tab.c"
+    break;
+
+  case 142: /* $@15: %empty  */
+#line 620 "dylan.y"
+                                 { pop_intermediate_words (); }
+#line 2922 "dylan.tab.c"
+    break;
+
+  case 143: /* for_statement: FOR $@13 '(' for_clauses_opt for_terminator_opt $@14 ')' body finally_opt END $@15 FOR_opt  */
+#line 621 "dylan.y"
+                { yyval = listem (for_symbol,
+			       yyvsp[-8],
+			       append_bang(yyvsp[-7], yyvsp[-3]),
+			       yyvsp[-4],
+			       NULL);
+		}
+#line 2933 "dylan.tab.c"
+    break;
+
+  case 144: /* for_clauses: for_clause comma_opt  */
+#line 628 "dylan.y"
+                                        { yyval = cons (yyvsp[-1], make_empty_list()); }
+#line 2939 "dylan.tab.c"
+    break;
+
+  case 145: /* for_clauses: for_clause ',' for_clauses  */
+#line 629 "dylan.y"
+                                        { yyval = cons (yyvsp[-2], yyvsp[0]); }
+#line 2945 "dylan.tab.c"
+    break;
+
+  case 146: /* for_clauses_opt: %empty  */
+#line 632 "dylan.y"
+                                { yyval = make_empty_list(); }
+#line 2951 "dylan.tab.c"
+    break;
+
+  case 147: /* for_clauses_opt: for_clauses  */
+#line 633 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 2957 "dylan.tab.c"
+    break;
+
+  case 148: /* for_clause: variable '=' expression THEN expression  */
+#line 637 "dylan.y"
+                { yyval = cons (yyvsp[-4], cons (yyvsp[-2], cons (yyvsp[0], make_empty_list()))); }
+#line 2963 "dylan.tab.c"
+    break;
+
+  case 149: /* for_clause: variable IN expression  */
+#line 639 "dylan.y"
+            { yyval = cons (collection_keyword,
+			 cons (yyvsp[-2], cons (yyvsp[0], make_empty_list()))); }
+#line 2970 "dylan.tab.c"
+    break;
+
+  case 150: /* for_clause: variable FROM expression bound_opt increment_clause_opt  */
+#line 642 "dylan.y"
+                { yyval = cons (range_keyword,
+			     cons (yyvsp[-4],
+				   cons (yyvsp[-2],
+					 append_bang(yyvsp[-1], yyvsp[0])))); }
+#line 2979 "dylan.tab.c"
+    break;
+
+  case 151: /* bound_opt: %empty  */
+#line 648 "dylan.y"
+                { yyval = make_empty_list(); }
+#line 2985 "dylan.tab.c"
+    break;
+
+  case 152: /* bound_opt: TO expression  */
+#line 650 "dylan.y"
+                { yyval = cons (yyvsp[-1], cons (yyvsp[0], make_empty_list())); }
+#line 2991 "dylan.tab.c"
+    break;
+
+  case 153: /* bound_opt: ABOVE expression  */
+#line 652 "dylan.y"
+                { yyval = cons (yyvsp[-1], cons (yyvsp[0], make_empty_list())); }
+#line 2997 "dylan.tab.c"
+    break;
+
+  case 154: /* bound_opt: BELOW expression  */
+#line 654 "dylan.y"
+                { yyval = cons (yyvsp[-1], cons (yyvsp[0], make_empty_list())); }
+#line 3003 "dylan.tab.c"
+    break;
+
+  case 155: /* increment_clause_opt: %empty  */
+#line 657 "dylan.y"
+                { yyval = make_empty_list(); }
+#line 3009 "dylan.tab.c"
+    break;
+
+  case 156: /* increment_clause_opt: BY expression  */
+#line 659 "dylan.y"
+                { yyval = cons (yyvsp[-1], cons (yyvsp[0], make_empty_list())); }
+#line 3015 "dylan.tab.c"
+    break;
+
+  case 157: /* for_terminator_opt: %empty  */
+#line 662 "dylan.y"
+                                { yyval = cons (MARLAIS_FALSE,
+					     make_empty_list()); }
+#line 3022 "dylan.tab.c"
+    break;
+
+  case 158: /* for_terminator_opt: UNTIL expression  */
+#line 664 "dylan.y"
+                                { yyval = cons (yyvsp[0], make_empty_list()); }
+#line 3028 "dylan.tab.c"
+    break;
+
+  case 159: /* for_terminator_opt: WHILE expression  */
+#line 665 "dylan.y"
+                                { yyval = cons (cons (not_symbol,
+					           cons (yyvsp[0],
+                                                         make_empty_list())),
+                                             make_empty_list()); }
+#line 3037 "dylan.tab.c"
+    break;
+
+  case 160: /* for_terminator_opt: KEYWORD expression  */
+#line 669 "dylan.y"
+                                { if (yyvsp[-1] == until_keyword) {
+				      yyval =cons (yyvsp[0], make_empty_list());
+				  } else if (yyvsp[-1] == while_keyword) {
+				      yyval = cons (cons (not_symbol,
+						       cons (yyvsp[0],
+							     make_empty_list())),
+					         make_empty_list());
+				  } else {
+					marlais_error ("Bogus keyword in if",
+						yyvsp[-1],
+						NULL);
+				  }
+				}
+#line 3055 "dylan.tab.c"
+    break;
+
+  case 161: /* finally_opt: %empty  */
+#line 684 "dylan.y"
+                                { yyval = make_empty_list(); }
+#line 3061 "dylan.tab.c"
+    break;
+
+  case 162: /* finally_opt: FINALLY body  */
+#line 685 "dylan.y"
+                                { yyval = cons (yyvsp[0], make_empty_list()); }
+#line 3067 "dylan.tab.c"
+    break;
+
+  case 163: /* $@16: %empty  */
+#line 688 "dylan.y"
+                        { push_intermediate_words (yyvsp[0]); }
+#line 3073 "dylan.tab.c"
+    break;
+
+  case 164: /* $@17: %empty  */
+#line 694 "dylan.y"
+                        { pop_intermediate_words ();
+			  if (! EMPTYLISTP (yyvsp[0])) {
+				marlais_warning ("Exceptions not yet implemented!",
+					 NULL);
+				}
+			}
+#line 3084 "dylan.tab.c"
+    break;
+
+  case 165: /* block_statement: BLOCK $@16 '(' variable_name ')' body afterwards_opt cleanup_opt exceptions $@17 END BLOCK_opt  */
+#line 702 "dylan.y"
+                { yyval = listem (bind_exit_symbol,
+			       cons (yyvsp[-8], make_empty_list()),
+                               nelistem(unwind_protect_symbol,
+					nelistem (bind_symbol,
+					       cons (listem (hash_rest_symbol,
+							       vals_symbol,
+							       yyvsp[-6],
+							       NULL),
+						     make_empty_list()),
+					       yyvsp[-5],
+					       listem (apply_symbol,
+						       yyvsp[-8],
+						       vals_symbol,
+						       NULL),
+					       NULL),
+					yyvsp[-4],
+					NULL),
+				NULL);
+		}
+#line 3108 "dylan.tab.c"
+    break;
+
+  case 166: /* afterwards_opt: %empty  */
+#line 723 "dylan.y"
+                                { yyval = make_empty_list(); }
+#line 3114 "dylan.tab.c"
+    break;
+
+  case 167: /* afterwards_opt: AFTERWARDS body  */
+#line 724 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 3120 "dylan.tab.c"
+    break;
+
+  case 168: /* cleanup_opt: %empty  */
+#line 727 "dylan.y"
+                        { yyval = make_empty_list(); }
+#line 3126 "dylan.tab.c"
+    break;
+
+  case 169: /* cleanup_opt: CLEANUP body  */
+#line 728 "dylan.y"
+                        { yyval = yyvsp[0]; }
+#line 3132 "dylan.tab.c"
+    break;
+
+  case 170: /* exceptions: %empty  */
+#line 731 "dylan.y"
+                { yyval = make_empty_list(); }
+#line 3138 "dylan.tab.c"
+    break;
+
+  case 171: /* exceptions: exceptions EXCEPTION '(' exception_args ')' body  */
+#line 735 "dylan.y"
+                { yyval = cons (listem (yyvsp[-4], yyvsp[-2], yyvsp[0], NULL), yyvsp[-5]); }
+#line 3144 "dylan.tab.c"
+    break;
+
+  case 172: /* exception_args: variable_name  */
+#line 738 "dylan.y"
+                                { yyval = cons (yyvsp[0], make_empty_list()); }
+#line 3150 "dylan.tab.c"
+    break;
+
+  case 173: /* exception_args: variable_name COLON_COLON variable_name comma_arguments_opt  */
+#line 740 "dylan.y"
+                { yyval = cons (cons (yyvsp[-3], cons (yyvsp[-1], make_empty_list())), yyvsp[0]); }
+#line 3156 "dylan.tab.c"
+    break;
+
+  case 190: /* defining_form: DEFINE modifiers_opt METHOD method_definition  */
+#line 777 "dylan.y"
+                { yyval = cons (define_method_symbol, yyvsp[0]); }
+#line 3162 "dylan.tab.c"
+    break;
+
+  case 191: /* defining_form: DEFINE modifiers_opt FUNCTION function_definition  */
+#line 781 "dylan.y"
+                { yyval = cons (define_function_symbol, yyvsp[0]); }
+#line 3168 "dylan.tab.c"
+    break;
+
+  case 192: /* defining_form: DEFINE modifiers_opt GENERIC generic_function_definition  */
+#line 785 "dylan.y"
+                { yyval = cons (define_generic_function_symbol, yyvsp[0]); }
+#line 3174 "dylan.tab.c"
+    break;
+
+  case 193: /* defining_form: DEFINE VARIABLE bindings  */
+#line 790 "dylan.y"
+                { yyval = cons (define_variable_symbol, CAR (yyvsp[0])); }
+#line 3180 "dylan.tab.c"
+    break;
+
+  case 194: /* defining_form: DEFINE CONSTANT bindings  */
+#line 793 "dylan.y"
+                { yyval = cons (define_constant_symbol, CAR (yyvsp[0])); }
+#line 3186 "dylan.tab.c"
+    break;
+
+  case 195: /* $@18: %empty  */
+#line 796 "dylan.y"
+                { push_intermediate_words (yyvsp[0]); }
+#line 3192 "dylan.tab.c"
+    break;
+
+  case 196: /* defining_form: DEFINE modifiers_opt CLASS $@18 class_definition  */
+#line 798 "dylan.y"
+                { pop_intermediate_words ();
+		  if (EMPTYLISTP (yyvsp[-3])) {
+			yyval = cons (define_class_symbol, yyvsp[0]);
+		  } else {
+			yyval = cons (define_class_symbol,
+				   cons (cons (modifiers_keyword,
+					       yyvsp[-3]),
+					 yyvsp[0]));
+		  }
+		}
+#line 3207 "dylan.tab.c"
+    break;
+
+  case 197: /* $@19: %empty  */
+#line 813 "dylan.y"
+                { push_intermediate_words (yyvsp[0]); }
+#line 3213 "dylan.tab.c"
+    break;
+
+  case 198: /* defining_form: DEFINE MODULE $@19 module_definition  */
+#line 815 "dylan.y"
+                { yyval = cons (define_module_symbol, yyvsp[0]); }
+#line 3219 "dylan.tab.c"
+    break;
+
+  case 199: /* class_definition: variable_name expression_list slot_specs END CLASS_opt variable_name_opt  */
+#line 820 "dylan.y"
+                { yyval = cons (yyvsp[-5], cons (yyvsp[-4], yyvsp[-3])); }
+#line 3225 "dylan.tab.c"
+    break;
+
+  case 200: /* slot_specs: %empty  */
+#line 823 "dylan.y"
+                                        { yyval = make_empty_list(); }
+#line 3231 "dylan.tab.c"
+    break;
+
+  case 201: /* slot_specs: slot_spec  */
+#line 824 "dylan.y"
+                                        { yyval = cons (yyvsp[0], make_empty_list()); }
+#line 3237 "dylan.tab.c"
+    break;
+
+  case 202: /* slot_specs: slot_spec ';' slot_specs  */
+#line 825 "dylan.y"
+                                        { yyval = cons (yyvsp[-2], yyvsp[0]); }
+#line 3243 "dylan.tab.c"
+    break;
+
+  case 203: /* slot_spec: initialization_argument_spec  */
+#line 829 "dylan.y"
+                                       { yyval = yyvsp[0]; }
+#line 3249 "dylan.tab.c"
+    break;
+
+  case 204: /* slot_spec: slot_modifiers_opt SLOT variable comma_arguments_opt  */
+#line 832 "dylan.y"
+                { Object mods, mod;
+		  Object allocation, getter_name, slot_type, dynamism;
+		  int dynamism_specified = 0, allocation_specified = 0;
+		  int slot_type_specified = 0;
+
+		  slot_type = cons (type_keyword,
+				    cons (CLASSNAME (object_class),
+					  make_empty_list()));
+		  allocation = cons (allocation_keyword,
+				     cons (instance_symbol,
+					   make_empty_list()));
+		  dynamism = cons (dynamism_keyword,
+				   cons (open_symbol,
+					 make_empty_list()));
+		  if (PAIRP (yyvsp[-1])) {
+		      getter_name = CAR (yyvsp[-1]);
+		      slot_type_specified = 1;
+		      SECOND (slot_type) = SECOND (yyvsp[-1]);
+		  } else {
+		      getter_name = yyvsp[-1];
+		  }
+		  mods = yyvsp[-3];
+		  while ( PAIRP (mods)) {
+		      mod = CAR (mods);
+		      if (mod == open_symbol) {
+			  if (dynamism_specified) {
+			      marlais_error ("Slot dyanamism specified twice", NULL);
+			  }
+			  dynamism_specified = 1;
+		      } else if (mod == sealed_symbol) {
+			  if (dynamism_specified) {
+			      marlais_error ("Slot dyanamism specified twice", NULL);
+			  }
+			  SECOND (dynamism) = sealed_symbol;
+		      } else if (allocation_word (mod)) {
+			  if (allocation_specified) {
+			      marlais_error ("Slot allocation specified twice", NULL);
+			  }
+			  allocation_specified = 1;
+			  SECOND (allocation) = mod;
+			  if ( ! EMPTYLISTP (CDR (mods))) {
+			      marlais_error ("Slot modifiers follow allocation",
+				     mods, NULL);
+			  }
+		      }
+		      mods = CDR (mods);
+		  }
+		  yyval = cons (getter_name, yyvsp[0]);
+		  if (slot_type_specified) {
+		      append_bang (yyval, slot_type);
+		  }
+		  if (allocation_specified) {
+		      append_bang (yyval, allocation);
+		  }
+		  if (dynamism_specified) {
+		      append_bang (yyval, dynamism);
+		  }
+		}
+#line 3312 "dylan.tab.c"
+    break;
+
+  case 205: /* slot_modifiers_opt: %empty  */
+#line 892 "dylan.y"
+                                        { yyval = make_empty_list(); }
+#line 3318 "dylan.tab.c"
+    break;
+
+  case 206: /* slot_modifiers_opt: SYMBOL slot_modifiers_opt  */
+#line 893 "dylan.y"
+                                        { yyval = cons (yyvsp[-1], yyvsp[0]); }
+#line 3324 "dylan.tab.c"
+    break;
+
+  case 207: /* slot_modifiers_opt: CLASS slot_modifiers_opt  */
+#line 894 "dylan.y"
+                                        { yyval = cons (yyvsp[-1], yyvsp[0]); }
+#line 3330 "dylan.tab.c"
+    break;
+
+  case 208: /* initialization_argument_spec: SYMBOL KEYWORD comma_arguments_opt  */
+#line 898 "dylan.y"
+                {
+		  if (yyvsp[-2] != keyword_symbol) {
+			marlais_error ("Bad initialization argument specification", NULL);
+		  } else {
+			yyval = cons (init_keyword_keyword, cons (yyvsp[-1], yyvsp[0]));
+		  }
+		}
+#line 3342 "dylan.tab.c"
+    break;
+
+  case 209: /* initialization_argument_spec: SYMBOL SYMBOL KEYWORD comma_arguments_opt  */
+#line 906 "dylan.y"
+                {
+		  if (yyvsp[-3] != required_symbol || yyvsp[-2] != keyword_symbol) {
+			marlais_error ("Bad initialization argument specification", NULL);
+		  } else {
+			yyval = cons (required_init_keyword_keyword,
+				cons (yyvsp[-1], yyvsp[0]));
+		  }
+		}
+#line 3355 "dylan.tab.c"
+    break;
+
+  case 210: /* method_definition: variable_name method_body END METHOD_opt variable_name_opt  */
+#line 917 "dylan.y"
+                { yyval = cons (yyvsp[-4], yyvsp[-3]); }
+#line 3361 "dylan.tab.c"
+    break;
+
+  case 211: /* function_definition: variable_name method_body END FUNCTION_opt variable_name_opt  */
+#line 921 "dylan.y"
+                { yyval = cons (yyvsp[-4], yyvsp[-3]); }
+#line 3367 "dylan.tab.c"
+    break;
+
+  case 212: /* generic_function_definition: variable_name generic_function_body  */
+#line 925 "dylan.y"
+                { yyval = cons (yyvsp[-1], yyvsp[0]); }
+#line 3373 "dylan.tab.c"
+    break;
+
+  case 213: /* module_definition: variable_name module_clauses END MODULE_opt variable_name_opt  */
+#line 933 "dylan.y"
+                { yyval = cons (yyvsp[-4], yyvsp[-3]); }
+#line 3379 "dylan.tab.c"
+    break;
+
+  case 214: /* module_clauses: %empty  */
+#line 936 "dylan.y"
+                { yyval = make_empty_list(); }
+#line 3385 "dylan.tab.c"
+    break;
+
+  case 215: /* module_clauses: module_clause ';' module_clauses  */
+#line 938 "dylan.y"
+                { yyval = cons (yyvsp[-2], yyvsp[0]); }
+#line 3391 "dylan.tab.c"
+    break;
+
+  case 216: /* module_clause: use_clause  */
+#line 941 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 3397 "dylan.tab.c"
+    break;
+
+  case 217: /* module_clause: export_clause  */
+#line 942 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 3403 "dylan.tab.c"
+    break;
+
+  case 218: /* module_clause: create_clause  */
+#line 943 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 3409 "dylan.tab.c"
+    break;
+
+  case 219: /* use_clause: USE variable_name property_list_opt  */
+#line 947 "dylan.y"
+                { yyval = cons (yyvsp[-2], cons (yyvsp[-1], yyvsp[0])); }
+#line 3415 "dylan.tab.c"
+    break;
+
+  case 220: /* export_clause: EXPORT item_names  */
+#line 950 "dylan.y"
+                                { yyval = cons (yyvsp[-1], yyvsp[0]); }
+#line 3421 "dylan.tab.c"
+    break;
+
+  case 221: /* create_clause: CREATE item_names  */
+#line 952 "dylan.y"
+                                { yyval = cons (yyvsp[-1], yyvsp[0]); }
+#line 3427 "dylan.tab.c"
+    break;
+
+  case 222: /* modifiers: SYMBOL  */
+#line 955 "dylan.y"
+                                { yyval = cons (yyvsp[0], make_empty_list()); }
+#line 3433 "dylan.tab.c"
+    break;
+
+  case 223: /* modifiers: SYMBOL modifiers  */
+#line 956 "dylan.y"
+                                { yyval = cons (yyvsp[-1], yyvsp[0]); }
+#line 3439 "dylan.tab.c"
+    break;
+
+  case 224: /* expression_list: '(' expressions_opt ')'  */
+#line 959 "dylan.y"
+                                        { yyval = yyvsp[-1]; }
+#line 3445 "dylan.tab.c"
+    break;
+
+  case 225: /* expressions: expression  */
+#line 962 "dylan.y"
+                                        { yyval = cons (yyvsp[0], make_empty_list()); }
+#line 3451 "dylan.tab.c"
+    break;
+
+  case 226: /* expressions: expression ',' expressions  */
+#line 963 "dylan.y"
+                                        { yyval = cons ( yyvsp[-2], yyvsp[0]); }
+#line 3457 "dylan.tab.c"
+    break;
+
+  case 227: /* item_names: variable_name  */
+#line 982 "dylan.y"
+                                        { yyval = cons (yyvsp[0], make_empty_list()); }
+#line 3463 "dylan.tab.c"
+    break;
+
+  case 228: /* item_names: variable_name ',' item_names  */
+#line 983 "dylan.y"
+                                        { yyval = cons (yyvsp[-2], yyvsp[0]); }
+#line 3469 "dylan.tab.c"
+    break;
+
+  case 229: /* $@20: %empty  */
+#line 990 "dylan.y"
+                {
+#ifdef OPTIMIZE_SPECIALIZERS
+		    symtab_push_parameters (yyvsp[-1]);
+#endif
+		}
+#line 3479 "dylan.tab.c"
+    break;
+
+  case 230: /* method_body: '(' parameter_list_opt ')' $@20 SEMICOLON_opt body  */
+#line 996 "dylan.y"
+                {
+#ifdef OPTIMIZE_SPECIALIZERS
+		    symtab_pop ();
+#endif
+		    yyval = cons (yyvsp[-4], cons (yyvsp[0], make_empty_list()));
+		}
+#line 3490 "dylan.tab.c"
+    break;
+
+  case 231: /* method_body: '(' parameter_list_opt ')' EQUAL_ARROW variable ';' body  */
+#line 1003 "dylan.y"
+                { yyval = cons (append_bang (yyvsp[-5],
+					  cons (hash_values_symbol,
+						cons (yyvsp[-2], make_empty_list()))),
+			     cons (yyvsp[0], make_empty_list())); }
+#line 3499 "dylan.tab.c"
+    break;
+
+  case 232: /* method_body: '(' parameter_list_opt ')' EQUAL_ARROW '(' value_list_opt ')' SEMICOLON_opt body  */
+#line 1009 "dylan.y"
+                { yyval = cons (append_bang (yyvsp[-7],
+					  cons (hash_values_symbol, yyvsp[-3])),
+			     cons ( yyvsp[0], make_empty_list())); }
+#line 3507 "dylan.tab.c"
+    break;
+
+  case 233: /* generic_function_body: '(' parameter_list_opt ')'  */
+#line 1014 "dylan.y"
+                { yyval = cons (yyvsp[-1], make_empty_list()); }
+#line 3513 "dylan.tab.c"
+    break;
+
+  case 234: /* generic_function_body: '(' parameter_list_opt ')' EQUAL_ARROW variable  */
+#line 1016 "dylan.y"
+                { yyval = cons (append_bang (yyvsp[-3], cons (hash_values_symbol,
+					      cons (yyvsp[0], make_empty_list()))),
+			     make_empty_list()); }
+#line 3521 "dylan.tab.c"
+    break;
+
+  case 235: /* generic_function_body: '(' parameter_list_opt ')' EQUAL_ARROW '(' value_list_opt ')'  */
+#line 1020 "dylan.y"
+                { yyval = cons (append_bang (yyvsp[-5], cons (hash_values_symbol, yyvsp[-1])),
+		 	     make_empty_list()); }
+#line 3528 "dylan.tab.c"
+    break;
+
+  case 236: /* parameter_list: parameter  */
+#line 1024 "dylan.y"
+                                { yyval = cons (yyvsp[0], make_empty_list()); }
+#line 3534 "dylan.tab.c"
+    break;
+
+  case 237: /* parameter_list: parameter_list ',' parameter  */
+#line 1026 "dylan.y"
+                { yyval = append_bang (yyvsp[-2], cons (yyvsp[0], make_empty_list())); }
+#line 3540 "dylan.tab.c"
+    break;
+
+  case 238: /* parameter_list: parameter_list ',' next_rest_key_parameter_list  */
+#line 1028 "dylan.y"
+                        { yyval = append_bang (yyvsp[-2], yyvsp[0]); }
+#line 3546 "dylan.tab.c"
+    break;
+
+  case 239: /* parameter_list: next_rest_key_parameter_list  */
+#line 1030 "dylan.y"
+                        { yyval = yyvsp[0]; }
+#line 3552 "dylan.tab.c"
+    break;
+
+  case 240: /* next_rest_key_parameter_list: HASH_NEXT variable_name  */
+#line 1034 "dylan.y"
+                { yyval = cons (yyvsp[-1], cons (yyvsp[0], make_empty_list())); }
+#line 3558 "dylan.tab.c"
+    break;
+
+  case 241: /* next_rest_key_parameter_list: HASH_NEXT variable_name ',' rest_key_parameter_list  */
+#line 1036 "dylan.y"
+                { yyval = cons (yyvsp[-3], cons (yyvsp[-2], yyvsp[0])); }
+#line 3564 "dylan.tab.c"
+    break;
+
+  case 242: /* next_rest_key_parameter_list: rest_key_parameter_list  */
+#line 1038 "dylan.y"
+                { yyval = yyvsp[0]; }
+#line 3570 "dylan.tab.c"
+    break;
+
+  case 243: /* rest_key_parameter_list: HASH_REST variable_name  */
+#line 1042 "dylan.y"
+                { yyval = cons (yyvsp[-1], cons (yyvsp[0], make_empty_list())); }
+#line 3576 "dylan.tab.c"
+    break;
+
+  case 244: /* rest_key_parameter_list: HASH_REST variable_name ',' key_parameter_list  */
+#line 1044 "dylan.y"
+                { yyval = cons (yyvsp[-3], cons (yyvsp[-2], yyvsp[0])); }
+#line 3582 "dylan.tab.c"
+    break;
+
+  case 245: /* rest_key_parameter_list: key_parameter_list  */
+#line 1046 "dylan.y"
+                { yyval = yyvsp[0]; }
+#line 3588 "dylan.tab.c"
+    break;
+
+  case 246: /* key_parameter_list: HASH_KEY  */
+#line 1049 "dylan.y"
+                        { yyval = cons (yyvsp[0], make_empty_list()); }
+#line 3594 "dylan.tab.c"
+    break;
+
+  case 247: /* key_parameter_list: HASH_KEY ',' HASH_ALL_KEYS  */
+#line 1051 "dylan.y"
+                        { yyval = cons (yyvsp[-2], cons (yyvsp[0], make_empty_list())); }
+#line 3600 "dylan.tab.c"
+    break;
+
+  case 248: /* key_parameter_list: HASH_KEY keyword_parameters  */
+#line 1053 "dylan.y"
+                        { yyval = cons (yyvsp[-1], yyvsp[0]); }
+#line 3606 "dylan.tab.c"
+    break;
+
+  case 249: /* key_parameter_list: HASH_ALL_KEYS  */
+#line 1055 "dylan.y"
+                { yyval = cons (yyvsp[0], make_empty_list()); }
+#line 3612 "dylan.tab.c"
+    break;
+
+  case 250: /* parameter: variable_name type_designator_opt  */
+#line 1059 "dylan.y"
+                { yyval = (yyvsp[0] ? cons (yyvsp[-1], cons (yyvsp[0], make_empty_list()))
+			: yyvsp[-1]);
+		}
+#line 3620 "dylan.tab.c"
+    break;
+
+  case 251: /* parameter: variable_name EQUAL_EQUAL expression  */
+#line 1063 "dylan.y"
+                { yyval = cons (yyvsp[-2], cons (cons (singleton_symbol,
+					     cons (yyvsp[0], make_empty_list())),
+				       make_empty_list())); }
+#line 3628 "dylan.tab.c"
+    break;
+
+  case 252: /* keyword_parameters: keyword_parameter  */
+#line 1068 "dylan.y"
+                                { yyval = cons (yyvsp[0], make_empty_list()); }
+#line 3634 "dylan.tab.c"
+    break;
+
+  case 253: /* keyword_parameters: HASH_ALL_KEYS  */
+#line 1069 "dylan.y"
+                                { yyval = cons (yyvsp[0], make_empty_list()); }
+#line 3640 "dylan.tab.c"
+    break;
+
+  case 254: /* keyword_parameters: keyword_parameter ',' keyword_parameters  */
+#line 1071 "dylan.y"
+                        { yyval = cons (yyvsp[-2], yyvsp[0]); }
+#line 3646 "dylan.tab.c"
+    break;
+
+  case 255: /* keyword_parameter: KEYWORD variable_name type_designator_opt default_opt  */
+#line 1076 "dylan.y"
+                { Object variable = yyvsp[-1] == NULL? yyvsp[-2]
+                                              : listem (yyvsp[-2], yyvsp[-1], NULL);
+		  if (yyvsp[0]) {
+		    if (yyvsp[-3]) {
+			yyval =cons (yyvsp[-3], cons (variable,
+					    cons(yyvsp[0], make_empty_list())));
+		    } else {
+			yyval = cons (variable,
+				   cons (yyvsp[0], make_empty_list ()));
+		    }
+		  } else {
+		      yyval = cons (yyvsp[-3], cons (variable, make_empty_list()));
+		  }
+		}
+#line 3665 "dylan.tab.c"
+    break;
+
+  case 256: /* keyword_parameter: variable_name type_designator_opt default_opt  */
+#line 1092 "dylan.y"
+                { Object variable = yyvsp[-1] == NULL? yyvsp[-2]
+					      : listem (yyvsp[-2], yyvsp[-1], NULL);
+		  if (yyvsp[0]) {
+		    yyval = cons (variable, cons (yyvsp[0], make_empty_list()));
+		} else {
+		    yyval = variable;
+		}
+	       }
+#line 3678 "dylan.tab.c"
+    break;
+
+  case 257: /* default: '=' expression  */
+#line 1101 "dylan.y"
+                                        { yyval = yyvsp[0]; }
+#line 3684 "dylan.tab.c"
+    break;
+
+  case 258: /* local_declaration: LET bindings  */
+#line 1123 "dylan.y"
+                {   bindings_increment ();
+#ifdef OPTIMIZE_SPECIALIZERS
+		    symtab_insert_bindings (yyvsp[0]);
+#endif
+		    yyval = cons (local_bind_symbol,
+			       cons (yyvsp[0], make_empty_list()));
+		}
+#line 3696 "dylan.tab.c"
+    break;
+
+  case 260: /* $@21: %empty  */
+#line 1131 "dylan.y"
+                { methnames = methdefs = make_empty_list(); }
+#line 3702 "dylan.tab.c"
+    break;
+
+  case 261: /* local_declaration: LOCAL $@21 local_methods  */
+#line 1134 "dylan.y"
+          {   Object methbindings = cons (append (methnames,
+						  cons (cons (values_symbol,
+							      methdefs),
+							make_empty_list())),
+					  make_empty_list());
+#ifdef OPTIMIZE_SPECIALIZERS
+	      symtab_insert_bindings (methbindings);
+#endif
+	      bindings_increment ();
+	      yyval = cons (local_bind_rec_symbol,
+			 cons ( methbindings,
+			       make_empty_list()));
+	  }
+#line 3720 "dylan.tab.c"
+    break;
+
+  case 262: /* condition: unparenthesized_operand  */
+#line 1150 "dylan.y"
+                                                { yyval = yyvsp[0]; }
+#line 3726 "dylan.tab.c"
+    break;
+
+  case 264: /* handler: expression  */
+#line 1153 "dylan.y"
+                                                { yyval = yyvsp[0]; }
+#line 3732 "dylan.tab.c"
+    break;
+
+  case 265: /* local_methods: METHOD_opt method_definition  */
+#line 1157 "dylan.y"
+                {
+		 methnames = cons (FIRST (yyvsp[0]), methnames);
+		 methdefs = cons (cons (method_symbol, CDR (yyvsp[0])), methdefs);
+		}
+#line 3741 "dylan.tab.c"
+    break;
+
+  case 266: /* $@22: %empty  */
+#line 1162 "dylan.y"
+                {
+		 methnames = cons (FIRST (yyvsp[-1]), methnames);
+		 methdefs = cons (cons (method_symbol, CDR (yyvsp[-1])), methdefs);
+		}
+#line 3750 "dylan.tab.c"
+    break;
+
+  case 268: /* bindings: variable '=' expression  */
+#line 1170 "dylan.y"
+                { yyval = cons (cons (yyvsp[-2], cons (yyvsp[0], make_empty_list())),
+			     make_empty_list()); }
+#line 3757 "dylan.tab.c"
+    break;
+
+  case 269: /* bindings: '(' variable_list ')' '=' expression  */
+#line 1173 "dylan.y"
+                  { yyval = cons (append_bang (yyvsp[-3], cons (yyvsp[0], make_empty_list())),
+			     make_empty_list()); }
+#line 3764 "dylan.tab.c"
+    break;
+
+  case 270: /* variable_list: variable  */
+#line 1177 "dylan.y"
+                                { yyval = cons (yyvsp[0], make_empty_list()); }
+#line 3770 "dylan.tab.c"
+    break;
+
+  case 271: /* variable_list: variable ',' variable_list  */
+#line 1179 "dylan.y"
+                                { yyval = cons (yyvsp[-2], yyvsp[0]); }
+#line 3776 "dylan.tab.c"
+    break;
+
+  case 272: /* variable_list: HASH_REST variable_name  */
+#line 1181 "dylan.y"
+                { yyval = cons (yyvsp[-1], cons (yyvsp[0], make_empty_list())); }
+#line 3782 "dylan.tab.c"
+    break;
+
+  case 273: /* value_variable_list: variable  */
+#line 1185 "dylan.y"
+                                { yyval = cons (yyvsp[0], make_empty_list()); }
+#line 3788 "dylan.tab.c"
+    break;
+
+  case 274: /* value_variable_list: variable ',' value_variable_list  */
+#line 1187 "dylan.y"
+                                { yyval = cons (yyvsp[-2], yyvsp[0]); }
+#line 3794 "dylan.tab.c"
+    break;
+
+  case 275: /* value_variable_list: HASH_REST variable  */
+#line 1189 "dylan.y"
+                { yyval = cons (yyvsp[-1], cons (yyvsp[0], make_empty_list())); }
+#line 3800 "dylan.tab.c"
+    break;
+
+  case 276: /* variable: variable_name type_designator_opt  */
+#line 1193 "dylan.y"
+                { yyval = (yyvsp[0] ? cons (yyvsp[-1], cons (yyvsp[0], make_empty_list()))
+			: yyvsp[-1]); }
+#line 3807 "dylan.tab.c"
+    break;
+
+  case 277: /* variable_name: SYMBOL  */
+#line 1197 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 3813 "dylan.tab.c"
+    break;
+
+  case 278: /* variable_name: defining_word  */
+#line 1198 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 3819 "dylan.tab.c"
+    break;
+
+  case 279: /* variable_name_opt: %empty  */
+#line 1201 "dylan.y"
+                                { yyval = NULL; }
+#line 3825 "dylan.tab.c"
+    break;
+
+  case 280: /* variable_name_opt: variable_name  */
+#line 1202 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 3831 "dylan.tab.c"
+    break;
+
+  case 281: /* type_designator: COLON_COLON type  */
+#line 1205 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 3837 "dylan.tab.c"
+    break;
+
+  case 282: /* type: operand  */
+#line 1207 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 3843 "dylan.tab.c"
+    break;
+
+  case 283: /* property_list: property  */
+#line 1213 "dylan.y"
+                                        { yyval = cons (yyvsp[0], make_empty_list()); }
+#line 3849 "dylan.tab.c"
+    break;
+
+  case 284: /* property_list: property property_list  */
+#line 1214 "dylan.y"
+                                        { yyval = cons (yyvsp[-1], yyvsp[0]); }
+#line 3855 "dylan.tab.c"
+    break;
+
+  case 285: /* property: ',' KEYWORD value  */
+#line 1218 "dylan.y"
+                { yyval = cons (yyvsp[-1], yyvsp[0]); }
+#line 3861 "dylan.tab.c"
+    break;
+
+  case 286: /* value: expression  */
+#line 1220 "dylan.y"
+                                        { yyval = yyvsp[0]; }
+#line 3867 "dylan.tab.c"
+    break;
+
+  case 287: /* value: '{' property_set_opt '}'  */
+#line 1221 "dylan.y"
+                                        { yyval = yyvsp[-1]; }
+#line 3873 "dylan.tab.c"
+    break;
+
+  case 288: /* property_set: property_set_member  */
+#line 1224 "dylan.y"
+                                        { yyval = cons (yyvsp[0], make_empty_list()); }
+#line 3879 "dylan.tab.c"
+    break;
+
+  case 289: /* property_set: property_set_member ',' property_set  */
+#line 1225 "dylan.y"
+                                                        { yyval = cons (yyvsp[-2], yyvsp[0]); }
+#line 3885 "dylan.tab.c"
+    break;
+
+  case 290: /* property_set_member: property_set_item  */
+#line 1228 "dylan.y"
+                                        { yyval = yyvsp[0]; }
+#line 3891 "dylan.tab.c"
+    break;
+
+  case 291: /* property_set_member: property_set_item EQUAL_ARROW property_set_item  */
+#line 1230 "dylan.y"
+                { yyval = cons (yyvsp[-2], yyvsp[0]); }
+#line 3897 "dylan.tab.c"
+    break;
+
+  case 292: /* property_set_item: variable_name  */
+#line 1233 "dylan.y"
+                                        { yyval = yyvsp[0]; }
+#line 3903 "dylan.tab.c"
+    break;
+
+  case 293: /* EQUAL_ARROW_opt: %empty  */
+#line 1239 "dylan.y"
+                        { yyval = NULL; }
+#line 3909 "dylan.tab.c"
+    break;
+
+  case 294: /* EQUAL_ARROW_opt: EQUAL_ARROW  */
+#line 1240 "dylan.y"
+                        { yyval = yyvsp[0]; }
+#line 3915 "dylan.tab.c"
+    break;
+
+  case 307: /* comma_arguments_opt: %empty  */
+#line 1267 "dylan.y"
+                        { yyval = make_empty_list(); }
+#line 3921 "dylan.tab.c"
+    break;
+
+  case 308: /* comma_arguments_opt: ',' arguments  */
+#line 1268 "dylan.y"
+                        { yyval = yyvsp[0]; }
+#line 3927 "dylan.tab.c"
+    break;
+
+  case 309: /* arguments_opt: %empty  */
+#line 1271 "dylan.y"
+                        { yyval = make_empty_list(); }
+#line 3933 "dylan.tab.c"
+    break;
+
+  case 310: /* arguments_opt: arguments  */
+#line 1272 "dylan.y"
+                        { yyval = yyvsp[0]; }
+#line 3939 "dylan.tab.c"
+    break;
+
+  case 311: /* constants_opt: %empty  */
+#line 1275 "dylan.y"
+                        { yyval = make_empty_list(); }
+#line 3945 "dylan.tab.c"
+    break;
+
+  case 312: /* constants_opt: constants  */
+#line 1276 "dylan.y"
+                        { yyval = yyvsp[0]; }
+#line 3951 "dylan.tab.c"
+    break;
+
+  case 313: /* list_constants_opt: %empty  */
+#line 1279 "dylan.y"
+                                        { yyval = cons (list_symbol,
+						     make_empty_list()); }
+#line 3958 "dylan.tab.c"
+    break;
+
+  case 314: /* list_constants_opt: list_constants  */
+#line 1281 "dylan.y"
+                                        { yyval = yyvsp[0]; }
+#line 3964 "dylan.tab.c"
+    break;
+
+  case 315: /* default_opt: %empty  */
+#line 1284 "dylan.y"
+                        { yyval = NULL; }
+#line 3970 "dylan.tab.c"
+    break;
+
+  case 316: /* default_opt: default  */
+#line 1285 "dylan.y"
+                        { yyval = yyvsp[0]; }
+#line 3976 "dylan.tab.c"
+    break;
+
+  case 317: /* expressions_opt: %empty  */
+#line 1298 "dylan.y"
+                                { yyval = make_empty_list(); }
+#line 3982 "dylan.tab.c"
+    break;
+
+  case 318: /* expressions_opt: expressions  */
+#line 1299 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 3988 "dylan.tab.c"
+    break;
+
+  case 319: /* modifiers_opt: %empty  */
+#line 1308 "dylan.y"
+                                { yyval = make_empty_list(); }
+#line 3994 "dylan.tab.c"
+    break;
+
+  case 320: /* modifiers_opt: modifiers  */
+#line 1309 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 4000 "dylan.tab.c"
+    break;
+
+  case 321: /* parameter_list_opt: %empty  */
+#line 1312 "dylan.y"
+                                { yyval = make_empty_list(); }
+#line 4006 "dylan.tab.c"
+    break;
+
+  case 322: /* parameter_list_opt: parameter_list  */
+#line 1313 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 4012 "dylan.tab.c"
+    break;
+
+  case 323: /* property_list_opt: %empty  */
+#line 1316 "dylan.y"
+                                { yyval = make_empty_list(); }
+#line 4018 "dylan.tab.c"
+    break;
+
+  case 324: /* property_list_opt: property_list  */
+#line 1317 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 4024 "dylan.tab.c"
+    break;
+
+  case 325: /* property_set_opt: %empty  */
+#line 1320 "dylan.y"
+                                { yyval = make_empty_list(); }
+#line 4030 "dylan.tab.c"
+    break;
+
+  case 326: /* property_set_opt: property_set  */
+#line 1321 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 4036 "dylan.tab.c"
+    break;
+
+  case 327: /* type_designator_opt: %empty  */
+#line 1324 "dylan.y"
+                                { yyval = NULL; }
+#line 4042 "dylan.tab.c"
+    break;
+
+  case 328: /* type_designator_opt: type_designator  */
+#line 1325 "dylan.y"
+                                { yyval = yyvsp[0]; }
+#line 4048 "dylan.tab.c"
+    break;
+
+  case 329: /* value_list_opt: %empty  */
+#line 1328 "dylan.y"
+                                { yyval = make_empty_list(); }
+#line 4054 "dylan.tab.c"
+    break;
+
+  case 330: /* value_list_opt: value_variable_list  */
+#line 1329 "dylan.y"
+                                        { yyval = yyvsp[0]; }
+#line 4060 "dylan.tab.c"
+    break;
+
+
+#line 4064 "dylan.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 1331 "dylan.y"
+
+
+void yyerror(char *s)
+{
+    char line_str[20];
+    sprintf (line_str, " [line #%d]", yylineno);
+    marlais_warning (s,
+	     marlais_make_bytestring (yytext),
+	     marlais_make_bytestring (line_str),
+	     NULL);
+}
+
+/*
+ * append_bang appends l2 to l1 if l1 is nonempty.
+ * if l1 is empty, it just returns l2.
+ */
+static Object
+append_bang(Object l1, Object l2)
+{
+    Object res = l1;
+
+    if (EMPTYLISTP (l1)) {
+        return l2;
+#if 0
+	fprintf(stderr, "Whoa! append! to empty_list!\n");
+	abort();
+#endif
+    }
+    while (PAIRP (CDR (l1))) {
+	l1 = CDR (l1);
+    }
+    CDR (l1) = l2;
+    return res;
+}
+
+/*
+ *  nelistem lists together objects with the following provisos:
+ *  any objects aside from the first that are empty lists are not
+ *  consed into the result.
+ */
+static Object
+nelistem (Object car,...)
+{
+	Object fst, el, acons, cur;
+	va_list args;
+
+	fst = cur = acons = cons (car, make_empty_list ());
+	va_start (args, car);
+	el = va_arg (args, Object);
+
+	while (el) {
+	    if (!EMPTYLISTP (el)) {
+		acons = cons (el, make_empty_list());
+		CDR (cur) = acons;
+		cur = acons;
+	    }
+	    el = va_arg (args, Object);
+	}
+	va_end (args);
+	return (fst);
+}
+
+static void
+push_bindings()
+{
+    binding_stack = cons (marlais_make_integer(0), binding_stack);
+}
+
+static void
+pop_bindings()
+{
+    binding_stack = CDR (binding_stack);
+}
+
+
+static Object
+bindings_top ()
+{
+    return CAR (binding_stack);
+}
+
+static void
+bindings_increment ()
+{
+    CAR (binding_stack) = marlais_make_integer (INTVAL (CAR (binding_stack)) + 1);
+}
+
+static Object
+make_setter_expr (Object place, Object value)
+{
+    Object newsym;
+
+    if ( ! PAIRP (place)) {
+	error("Trying to make a setter from something that's not a place",
+	      place, NULL);
+    }
+    newsym = gensym(1);
+    return listem (unbinding_begin_symbol,
+		   marlais_make_integer (1),
+		   cons (local_bind_symbol,
+			 cons(cons(cons(newsym,
+					cons (value,
+					      make_empty_list())),
+				   make_empty_list()),
+			      make_empty_list())),
+		   cons (make_setter_symbol (FIRST (place)),
+			 cons (newsym, CDR (place))),
+		   newsym,
+		   NULL);
+}
+
+#define	GENSYM_BUFSIZE	128
+char gensymbuf[GENSYM_BUFSIZE];
+
+static Object
+gensym(int i)
+{
+    sprintf( gensymbuf, "\"tmp%d", i);
+    return make_symbol (gensymbuf);
+}
+
+static int
+allocation_word (Object word)
+{
+    return (word == instance_symbol || word == class_symbol
+	    || word == each_subclass_symbol || word == constant_symbol
+	    || word == virtual_symbol || word == inherited_symbol);
+}
+
+#ifdef OPTIMIZE_SPECIALIZERS
+static void
+symtab_push_begin ()
+{
+    symtab = cons (make_table (DEFAULT_TABLE_SIZE), symtab);
+}
+
+static void
+symtab_insert_bindings (Object bindings)
+{
+    Object variable;
+
+#if 0
+    marlais_warning ("Got symtab_insert_bindings", bindings, NULL);
+#endif
+
+    /*
+     * bindings created by parser are always of form
+     *  #( #( variable1, variable2, ... , variablen, values))
+     */
+    bindings = CAR (bindings);
+    while ( !EMPTYLISTP (CDR (bindings))) {
+	variable = CAR (bindings);
+	if (PAIRP (variable)) {
+#if 0
+	    marlais_warning ("  symtab element",
+		     CAR (variable),
+		     SECOND (variable),
+		     NULL);
+#endif
+	    table_element_setter (CAR (symtab),
+				  CAR (variable),
+				  SECOND (variable));
+	}
+	bindings = CDR (bindings);
+    }
+}
+
+static void
+symtab_push_parameters (Object parameters)
+{
+    Object variable;
+
+    symtab = cons (make_table (DEFAULT_TABLE_SIZE), symtab);
+#if 0
+    marlais_warning ("Got symtab_insert_parameters", parameters, NULL);
+#endif
+
+    while (PAIRP (parameters)) {
+	variable = CAR (parameters);
+	if (! PAIRP (variable) && ! SYMBOLP (variable) ) {
+	    /* we got to a keyword parameter or a hash-word */
+	    break;
+	}
+	if (PAIRP (variable)) {
+#if 0
+   marlais_warning ("  symtab element",
+		     CAR (variable),
+		     SECOND (variable),
+		     NULL);
+#endif
+	    table_element_setter (CAR (symtab),
+				  CAR (variable),
+				  SECOND (variable));
+	}
+	parameters = CDR (parameters);
+    }
+}
+
+static void
+symtab_pop ()
+{
+    symtab = CDR (symtab);
+}
+#endif
@@ -0,0 +1,139 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_DYLAN_TAB_H_INCLUDED
+# define YY_YY_DYLAN_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 1
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    SYMBOL = 258,                  /* SYMBOL  */
+    KEYWORD = 259,                 /* KEYWORD  */
+    LITERAL = 260,                 /* LITERAL  */
+    STRING = 261,                  /* STRING  */
+    COLON_EQUAL = 262,             /* COLON_EQUAL  */
+    GREATER_EQUAL = 263,           /* GREATER_EQUAL  */
+    LESSER_EQUAL = 264,            /* LESSER_EQUAL  */
+    NOT_EQUAL = 265,               /* NOT_EQUAL  */
+    NOT_EQUAL_EQUAL = 266,         /* NOT_EQUAL_EQUAL  */
+    EQUAL_EQUAL = 267,             /* EQUAL_EQUAL  */
+    EQUAL_ARROW = 268,             /* EQUAL_ARROW  */
+    COLON_COLON = 269,             /* COLON_COLON  */
+    QUESTION_QUESTION = 270,       /* QUESTION_QUESTION  */
+    ELLIPSIS = 271,                /* ELLIPSIS  */
+    UNRECOGNIZED = 272,            /* UNRECOGNIZED  */
+    EOF_TOKEN = 273,               /* EOF_TOKEN  */
+    HASH_T = 274,                  /* HASH_T  */
+    HASH_F = 275,                  /* HASH_F  */
+    HASH_BRACKET = 276,            /* HASH_BRACKET  */
+    HASH_PAREN = 277,              /* HASH_PAREN  */
+    HASH_NEXT = 278,               /* HASH_NEXT  */
+    HASH_REST = 279,               /* HASH_REST  */
+    HASH_KEY = 280,                /* HASH_KEY  */
+    HASH_ALL_KEYS = 281,           /* HASH_ALL_KEYS  */
+    DEFINE = 282,                  /* DEFINE  */
+    END = 283,                     /* END  */
+    GENERIC = 284,                 /* GENERIC  */
+    HANDLER = 285,                 /* HANDLER  */
+    LET = 286,                     /* LET  */
+    LOCAL = 287,                   /* LOCAL  */
+    METHOD = 288,                  /* METHOD  */
+    FUNCTION = 289,                /* FUNCTION  */
+    OTHERWISE = 290,               /* OTHERWISE  */
+    CLASS = 291,                   /* CLASS  */
+    CONSTANT = 292,                /* CONSTANT  */
+    LIBRARY = 293,                 /* LIBRARY  */
+    MODULE = 294,                  /* MODULE  */
+    VARIABLE = 295,                /* VARIABLE  */
+    SLOT = 296,                    /* SLOT  */
+    BEGIN_TOKEN = 297,             /* BEGIN_TOKEN  */
+    CASE = 298,                    /* CASE  */
+    IF = 299,                      /* IF  */
+    UNLESS = 300,                  /* UNLESS  */
+    UNTIL = 301,                   /* UNTIL  */
+    WHILE = 302,                   /* WHILE  */
+    BLOCK = 303,                   /* BLOCK  */
+    FOR = 304,                     /* FOR  */
+    SELECT = 305,                  /* SELECT  */
+    USE = 306,                     /* USE  */
+    EXPORT = 307,                  /* EXPORT  */
+    CREATE = 308,                  /* CREATE  */
+    ELSE = 309,                    /* ELSE  */
+    ELSEIF = 310,                  /* ELSEIF  */
+    BY = 311,                      /* BY  */
+    FINALLY = 312,                 /* FINALLY  */
+    THEN = 313,                    /* THEN  */
+    IN = 314,                      /* IN  */
+    FROM = 315,                    /* FROM  */
+    TO = 316,                      /* TO  */
+    ABOVE = 317,                   /* ABOVE  */
+    BELOW = 318,                   /* BELOW  */
+    AFTERWARDS = 319,              /* AFTERWARDS  */
+    CLEANUP = 320,                 /* CLEANUP  */
+    EXCEPTION = 321                /* EXCEPTION  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+typedef int YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+extern YYSTYPE yylval;
+
+
+int yyparse (void);
+
+
+#endif /* !YY_YY_DYLAN_TAB_H_INCLUDED  */
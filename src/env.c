@@ -22,7 +22,6 @@ extern Object dylan_symbol;
 extern Object dylan_user_symbol;
 extern Object empty_string;
 extern Object unwind_protect_symbol;
-extern jmp_buf *the_eval_context;
 
 int trace_bindings = 0;
 
@@ -42,12 +41,14 @@ struct modules modules =
 /* the top level environment */
 #define BIND_ALLOC_CHUNK 4
 
-/* If TOP_LEVEL_SIZE is not a power of two, see change required below */
+/* initial buckets of a top level table, must be a power of two */
 #define TOP_LEVEL_SIZE 1024
-/* struct binding *top_level_env[TOP_LEVEL_SIZE]; */
 
 /* local function prototypes */
-struct binding *symbol_binding (Object sym);
+static unsigned long symbol_hash (Object sym);
+static void insert_top_level_binding (struct top_level_table *table,
+				      struct binding *binding);
+static struct binding *next_binding (struct frame *frame);
 static Object concat_prefix (char *prefix_string, Object sym);
 static void fill_imports_table_from_property_set (Object imports_table,
 						  Object imports_set,
@@ -61,16 +62,56 @@ initialize_namespace (Object owner)
   struct frame *frame;
 
   frame = MARLAIS_ALLOCATE_STRUCT (struct frame);
-  frame->size = TOP_LEVEL_SIZE;
+  frame->size = frame->capacity = frame->reserved = 0;
   frame->owner = owner;
-  frame->bindings =
-    (struct binding **) marlais_allocate_memory (TOP_LEVEL_SIZE * sizeof (struct binding));
+  frame->bindings = NULL;
   frame->next = NULL;
-  frame->top_level_env = frame->bindings;
+  frame->top_level_env = MARLAIS_ALLOCATE_STRUCT (struct top_level_table);
+  frame->top_level_env->size = TOP_LEVEL_SIZE;
+  frame->top_level_env->count = 0;
+  frame->top_level_env->buckets = (struct binding **)
+    marlais_allocate_memory (TOP_LEVEL_SIZE * sizeof (struct binding *));
 
   return frame;
 }
 
+/* the folded name hash interned with the symbol. */
+static unsigned long
+symbol_hash (Object sym)
+{
+  return (SYMBOLHASH (sym));
+}
+
+static void
+insert_top_level_binding (struct top_level_table *table,
+			  struct binding *binding)
+{
+  struct binding **buckets, *next;
+  int i, size;
+  unsigned long h;
+
+  if (table->count >= table->size) {
+    /* keep the chains short as the module grows */
+    size = table->size * 2;
+    buckets = (struct binding **)
+      marlais_allocate_memory (size * sizeof (struct binding *));
+    for (i = 0; i < table->size; ++i) {
+      for (; table->buckets[i]; table->buckets[i] = next) {
+	next = table->buckets[i]->next;
+	h = symbol_hash (table->buckets[i]->sym) & (size - 1);
+	table->buckets[i]->next = buckets[h];
+	buckets[h] = table->buckets[i];
+      }
+    }
+    table->size = size;
+    table->buckets = buckets;
+  }
+  h = symbol_hash (binding->sym) & (table->size - 1);
+  binding->next = table->buckets[h];
+  table->buckets[h] = binding;
+  table->count++;
+}
+
 void add_top_level_binding(Object sym, Object val, int constant)
 {
   add_top_lvl_binding1(sym, val, constant, 1);
@@ -80,19 +121,29 @@ void
 add_top_lvl_binding1(Object sym, Object val, int constant, int exported)
 {
   struct binding *binding, *old_binding;
-  int i;
-  unsigned h;
-  char *str;
-
-  binding = MARLAIS_ALLOCATE_STRUCT (struct binding);
+  Object name, type;
 
   if (PAIRP (sym)) {
-    binding->sym = CAR (sym);
-    binding->type = eval (SECOND (sym));
+    name = CAR (sym);
+    type = eval (SECOND (sym));
   } else {
-    binding->sym = sym;
-    binding->type = object_class;
+    name = sym;
+    type = object_class;
+  }
+
+  /* a redefinition reuses the binding, which may already be in use as
+     a value cell, but gives it new storage as before since an imported
+     binding shares its storage with the module it came from. */
+  old_binding = symbol_binding_top_level (name);
+  if (old_binding != NULL) {
+    marlais_warning ("Symbol already defined. Previous value", sym,
+	     *(old_binding->val), NULL);
+    binding = old_binding;
+  } else {
+    binding = MARLAIS_ALLOCATE_STRUCT (struct binding);
+    binding->sym = name;
   }
+  binding->type = type;
 
   binding->props &= !IMPORTED_BINDING;
 
@@ -103,29 +154,13 @@ add_top_lvl_binding1(Object sym, Object val, int constant, int exported)
   if (constant) {
     binding->props |= CONSTANT_BINDING;
   }
-  old_binding = symbol_binding_top_level (binding->sym);
-  if (old_binding != NULL) {
-    marlais_warning ("Symbol already defined. Previous value", sym,
-	     *(old_binding->val), NULL);
-  }
   binding->val = (Object *) marlais_allocate_memory (sizeof (Object *));
 
   *(binding->val) = val;
 
-  i = h = 0;
-  str = SYMBOLNAME (binding->sym);
-  while (str[i]) {
-    h += str[i++];
+  if (binding != old_binding) {
+    insert_top_level_binding (the_env->top_level_env, binding);
   }
-/*
-   h = h % TOP_LEVEL_SIZE;
- */
-
-  /* Works only if TOP_LEVEL_SIZE is a power of 2 */
-  h &= (TOP_LEVEL_SIZE - 1);
-
-  binding->next = the_env->top_level_env[h];
-  the_env->top_level_env[h] = binding;
 
   if (trace_bindings) {
     marlais_print_obj (marlais_standard_error, sym);
@@ -140,7 +175,7 @@ push_scope (Object owner)
   /* push a new frame */
   frame = MARLAIS_ALLOCATE_STRUCT (struct frame);
   frame->owner = owner;
-  frame->size = 0;
+  frame->size = frame->capacity = frame->reserved = 0;
   frame->bindings = NULL;
   frame->next = the_env;
   frame->top_level_env = the_env->top_level_env;
@@ -149,6 +184,62 @@ push_scope (Object owner)
   eval_stack->frame = frame;
 }
 
+/* push a frame with room for count bindings.  the frame, its bindings
+   and their values are one allocation, so binding no more than count
+   variables in it allocates nothing else. */
+void
+push_sized_scope (Object owner, int count)
+{
+  struct frame *frame;
+  struct binding *bindings;
+  Object *vals;
+  int i;
+
+  frame = (struct frame *)
+    marlais_allocate_memory (sizeof (struct frame)
+			     + count * (sizeof (struct binding *)
+					+ sizeof (struct binding)
+					+ sizeof (Object)));
+  frame->owner = owner;
+  frame->size = 0;
+  frame->capacity = frame->reserved = count;
+  frame->bindings = (struct binding **) (frame + 1);
+  bindings = (struct binding *) (frame->bindings + count);
+  vals = (Object *) (bindings + count);
+  for (i = 0; i < count; ++i) {
+    bindings[i].val = &vals[i];
+    frame->bindings[i] = &bindings[i];
+  }
+  frame->next = the_env;
+  frame->top_level_env = the_env->top_level_env;
+
+  the_env = frame;
+  eval_stack->frame = frame;
+}
+
+/* the binding to fill in at the end of frame. */
+static struct binding *
+next_binding (struct frame *frame)
+{
+  struct binding **bindings, *binding;
+
+  if (frame->size < frame->reserved) {
+    return (frame->bindings[frame->size++]);
+  }
+  if (frame->size == frame->capacity) {
+    /* the old array may be part of the frame, so copy it */
+    frame->capacity += BIND_ALLOC_CHUNK;
+    bindings = (struct binding **)
+      marlais_allocate_memory (frame->capacity * sizeof (struct binding *));
+    memcpy (bindings, frame->bindings, frame->size * sizeof (struct binding *));
+    frame->bindings = bindings;
+  }
+  binding = MARLAIS_ALLOCATE_STRUCT (struct binding);
+  binding->val = (Object *) marlais_allocate_memory (sizeof (Object));
+  frame->bindings[frame->size++] = binding;
+  return (binding);
+}
+
 void
 pop_scope (void)
 {
@@ -158,88 +249,77 @@ pop_scope (void)
 void
 add_bindings (Object syms, Object vals, int constant, struct frame *to_frame)
 {
-  struct frame *frame;
   struct binding *binding;
-  int num_bindings, i;
-  Object sym_list;
-
-  sym_list = syms;
-  num_bindings = 0;
-  while (!EMPTYLISTP (sym_list)) {
-    num_bindings++;
-    sym_list = CDR (sym_list);
-  }
-
-  frame = to_frame;
-
-  frame->bindings = (struct binding **)
-    marlais_reallocate_memory (frame->bindings,
-		      (frame->size + num_bindings) * sizeof(struct binding *));
 
-  for (i = 0; i < num_bindings; ++i) {
+  while (!EMPTYLISTP (syms)) {
     if ((!syms) || (!vals)) {
       marlais_error ("mismatched number of symbols and values", NULL);
     }
-    binding = MARLAIS_ALLOCATE_STRUCT (struct binding);
+    binding = next_binding (to_frame);
     binding->sym = CAR (syms);
     /* ??? */
     binding->type = object_class;
-    binding->val = (Object *) marlais_allocate_memory (sizeof (Object *));
 
     *(binding->val) = CAR (vals);
 
-    binding->props &= !IMPORTED_BINDING;
     /* Just for now */
-    binding->props |= EXPORTED_BINDING;
+    binding->props = EXPORTED_BINDING;
     if (constant) {
       binding->props |= CONSTANT_BINDING;
     }
-    frame->bindings[i + frame->size] = binding;
 
     syms = CDR (syms);
     vals = CDR (vals);
   }
-  frame->size += num_bindings;
 }
 
 void
 add_binding (Object sym, Object val, int constant, struct frame *to_frame)
 {
-    struct frame *frame;
+    fill_binding (next_binding (to_frame), sym, val, constant);
+}
+
+/* a binding at the end of frame that no variable reference finds
+   until fill_binding gives it a symbol. */
+struct binding *
+reserve_binding (struct frame *frame)
+{
     struct binding *binding;
 
-    binding = MARLAIS_ALLOCATE_STRUCT (struct binding);
+    binding = next_binding (frame);
+    binding->sym = NULL;
+    binding->type = object_class;
+    *(binding->val) = uninit_slot_object;
+    binding->props = 0;
+    return (binding);
+}
+
+void
+fill_binding (struct binding *binding, Object sym, Object val, int constant)
+{
+    Object type;
+
     if (PAIRP (sym)) {
-	binding->sym = CAR (sym);
-	binding->type = eval (SECOND (sym));
+	type = eval (SECOND (sym));
+	sym = CAR (sym);
     } else {
-	binding->sym = sym;
-	binding->type = object_class;
+	type = object_class;
     }
-    binding->val = (Object *) marlais_allocate_memory (sizeof (Object *));
 
-    if (!instance (val, binding->type)) {
+    if (type != object_class && !instance (val, type)) {
 	marlais_error ("add_binding: value does not satisfy type constraint",
 	       val,
-	       binding->type,
+	       type,
 	       NULL);
     }
+    binding->sym = sym;
+    binding->type = type;
     *(binding->val) = val;
-    binding->props &= !IMPORTED_BINDING;
     /* Just for now */
-    binding->props |= EXPORTED_BINDING;
+    binding->props = EXPORTED_BINDING;
     if (constant) {
 	binding->props |= CONSTANT_BINDING;
     }
-    frame = to_frame;
-
-    if ((frame->size % BIND_ALLOC_CHUNK) == 0) {
-	frame->bindings = (struct binding **)
-	    marlais_reallocate_memory (frame->bindings,
-	      (frame->size + BIND_ALLOC_CHUNK) * sizeof (struct binding *));
-    }
-    frame->bindings[frame->size] = binding;
-    frame->size++;
 }
 
 /* Change the binding of the symbol in top-most frame.
@@ -288,9 +368,13 @@ symbol_value (Object sym)
 void
 modify_value (Object sym, Object new_val)
 {
-    struct binding *binding;
+    modify_binding (symbol_binding (sym), sym, new_val);
+}
 
-    binding = symbol_binding (sym);
+/* assign through binding, which was found for sym (or NULL). */
+void
+modify_binding (struct binding *binding, Object sym, Object new_val)
+{
     if (!binding) {
 	marlais_error ("attempt to modify value of unbound symbol", sym, NULL);
     } else if (IS_CONSTANT_BINDING (binding)) {
@@ -343,21 +427,23 @@ init_env_prims (void)
 struct binding *
 symbol_binding (Object sym)
 {
-    struct frame *frame;
+    return symbol_binding_from (the_env, sym);
+}
+
+/* look for sym starting at frame rather than at the_env. */
+struct binding *
+symbol_binding_from (struct frame *frame, Object sym)
+{
     struct binding *binding;
     int i;
 
-    frame = the_env;
-    while (frame->bindings != frame->top_level_env) {
+    for (; frame; frame = frame->next) {
 	for (i = 0; i < frame->size; ++i) {
 	    binding = frame->bindings[i];
 	    if (binding->sym == sym) {
 		return (binding);
 	    }
 	}
-	frame = frame->next;
-	if (!frame)
-	    break;		/* <pcb> I/'ve observed this to be nil in a special case. */
     }
     /* can't find binding in frames, look at top_level */
     return (symbol_binding_top_level (sym));
@@ -366,18 +452,11 @@ symbol_binding (Object sym)
 struct binding *
 symbol_binding_top_level (Object sym)
 {
+    struct top_level_table *table;
     struct binding *binding;
-    int h, i;
-    char *str;
-
-    i = h = 0;
-    str = SYMBOLNAME (sym);
-    while (str[i]) {
-	h += str[i++];
-    }
-    h = h % TOP_LEVEL_SIZE;
 
-    binding = the_env->top_level_env[h];
+    table = the_env->top_level_env;
+    binding = table->buckets[symbol_hash (sym) & (table->size - 1)];
     while (binding) {
 	if (binding->sym == sym) {
 	    return (binding);
@@ -396,35 +475,34 @@ unwind_to_exit (Object exit_proc)
 {
     struct frame *frame;
     Object body;
-    struct eval_stack *tmp_eval_stack, *save_eval_stack;
+    int depth, save_depth;
 
-    /* pop the current frame off the stack.  It can't be right. */
-    save_eval_stack = eval_stack;
-    tmp_eval_stack = eval_stack->next;
+    /* pop the current frame off the stack.  It can't be right.
+       the cleanups may grow the stack, so index it afresh each time. */
+    save_depth = eval_stack_depth - 1;
 
-    while (tmp_eval_stack) {
-	frame = tmp_eval_stack->frame;
-	if (frame->bindings) {
+    for (depth = eval_stack_depth - 2; depth >= 0; depth--) {
+	frame = eval_stack_base[depth].frame;
+	if (frame->size > 0) {
 	    if (frame->bindings[0] == EXITBINDING (exit_proc)) {
-		the_env = tmp_eval_stack->frame;
-		eval_stack = tmp_eval_stack;
+		the_env = frame;
+		set_eval_stack_depth (depth + 1);
 		return 1;
 	    }
-	    if (tmp_eval_stack->context == unwind_protect_symbol) {
+	    if (eval_stack_base[depth].context == unwind_protect_symbol) {
 		body = UNWINDBODY (*(frame->bindings[0]->val));
-		the_env = tmp_eval_stack->frame;
+		the_env = frame;
 		while (!EMPTYLISTP (body)) {
 		    eval (CAR (body));
 		    body = CDR (body);
 		}
 	    }
 	}
-	save_eval_stack = tmp_eval_stack;
-	tmp_eval_stack = tmp_eval_stack->next;
+	save_depth = depth;
     }
 
-    the_env = save_eval_stack->frame;
-    eval_stack = save_eval_stack;
+    the_env = eval_stack_base[save_depth].frame;
+    set_eval_stack_depth (save_depth + 1);
     marlais_error ("unwound to end of stack without finding exit context",
 	   exit_proc,
 	   NULL);
@@ -498,8 +576,8 @@ set_module (struct module_binding *new_module)
     struct module_binding *old_module = current_module ();
 
     the_env = new_module->namespace;
-    if (eval_stack && eval_stack->next == 0) {
-	eval_stack = 0;
+    if (eval_stack_depth == 1) {
+	set_eval_stack_depth (0);
     }
     push_eval_stack (new_module->sym);
     eval_stack->frame = the_env;
@@ -584,8 +662,8 @@ use_module (Object module_name,
 	import_module = module_binding (module_name);
 	frame = import_module->namespace;
 	/* Look at each has location */
-	for (i = 0; i < TOP_LEVEL_SIZE; i++) {
-	    binding = frame->top_level_env[i];
+	for (i = 0; i < frame->top_level_env->size; i++) {
+	    binding = frame->top_level_env->buckets[i];
 
 	    /* Look at each bucket in a hash location */
 	    while (binding) {
@@ -668,26 +746,9 @@ use_module (Object module_name,
 
 	    /* Now put the bindings in place. */
 	    while (bindings != NULL) {
-		int h, i;
-		char *str;
-
 		binding = bindings;
 		bindings = bindings->next;
-
-		i = h = 0;
-		str = SYMBOLNAME (binding->sym);
-		while (str[i]) {
-		    h += str[i++];
-		}
-		/*
-		   h = h % TOP_LEVEL_SIZE;
-		 */
-
-		/* Works only if TOP_LEVEL_SIZE is a power of 2 */
-		h &= (TOP_LEVEL_SIZE - 1);
-
-		binding->next = the_env->top_level_env[h];
-		the_env->top_level_env[h] = binding;
+		insert_top_level_binding (the_env->top_level_env, binding);
 	    }
 	}
     } else {
@@ -727,7 +788,7 @@ show_bindings (Object args)
 {
     struct frame *frame;
     int i;
-    int slot;
+    int slot, size;
     struct binding **bindings, *binding;
     int frame_number;
 
@@ -750,15 +811,23 @@ show_bindings (Object args)
 	/*
 	 * Print the bindings in all the frame slots.
 	 */
-	for (bindings = frame->bindings, slot = 0;
-	     slot < frame->size;
-	     slot++) {
+	if (TOP_LEVEL_FRAME_P (frame)) {
+	    bindings = frame->top_level_env->buckets;
+	    size = frame->top_level_env->size;
+	} else {
+	    bindings = frame->bindings;
+	    size = frame->size;
+	}
+	for (slot = 0; slot < size; slot++) {
 	    /*
 	     * Print the bindings in one slot
 	     */
-	    for (binding = frame->bindings[slot];
+	    for (binding = bindings[slot];
 		 binding != NULL;
 		 binding = binding->next) {
+		if (!binding->sym) {
+		    continue;	/* reserved, not yet bound */
+		}
 		fprintf (stderr, "   ");
 		marlais_print_object (marlais_standard_error, binding->sym, 1);
 		if (binding->type != object_class) {
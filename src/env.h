@@ -57,14 +57,29 @@ struct module_binding {
     Object exported_bindings;
 };
 
+/* a module's top level bindings, hashed on the symbol.  a binding
+   stays in its table for good, so it can be used as the symbol's
+   value cell once it has been found. */
+struct top_level_table {
+    int size;			/* buckets, a power of two */
+    int count;
+    struct binding **buckets;
+};
+
+/* the frame of a module's namespace holds no bindings of its own
+   and is the only frame with no next frame. */
 struct frame {
     int size;
+    int capacity;		/* room in bindings */
+    int reserved;		/* bindings allocated along with the frame */
     Object owner;
     struct binding **bindings;
     struct frame *next;
-    struct binding **top_level_env;
+    struct top_level_table *top_level_env;
 };
 
+#define TOP_LEVEL_FRAME_P(frame) ((frame)->next == NULL)
+
 extern struct frame *the_env;
 extern Object default_module;
 extern Object all_symbol;
@@ -74,20 +89,23 @@ void init_env_prims (void);
 void add_top_lvl_binding1(Object sym, Object val, int constant, int exported);
 void add_top_level_binding(Object sym, Object val, int constant);
 void push_scope (Object owner);
+void push_sized_scope (Object owner, int count);
 void pop_scope (void);
 Object print_env (struct frame *env);
 Object show_bindings (Object args);
 
-/* Warning!!! - you can't mix calls to add_bindings() and
-   add_binding() within the same frame.  Things will get
-   hopelessly screwed up.
- */
 void add_bindings (Object syms, Object vals, int constant, struct frame *to_frame);
 void add_binding (Object sym, Object val, int constant, struct frame *to_frame);
+struct binding *reserve_binding (struct frame *frame);
+void fill_binding (struct binding *binding, Object sym, Object val,
+		   int constant);
 int change_binding (Object sym, Object val);
 
 Object symbol_value (Object sym);
 void modify_value (Object sym, Object new_val);
+void modify_binding (struct binding *binding, Object sym, Object new_val);
+struct binding *symbol_binding (Object sym);
+struct binding *symbol_binding_from (struct frame *frame, Object sym);
 struct frame *current_env (void);
 int unwind_to_exit (Object exit_sym);
 struct binding *symbol_binding_top_level (Object sym);
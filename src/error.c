@@ -8,6 +8,7 @@
 
 #include "alloc.h"
 #include "apply.h"
+#include "bytecode.h"
 #include "bytestring.h"
 #include "class.h"
 #include "env.h"
@@ -241,6 +242,9 @@ marlais_error (char *msg,...)
   Object obj, signal_value, ret;
   jmp_buf *jmp_buf_ptr;
   static message_printed = 0;
+#ifdef USE_CONTINUATION_STACK
+  struct continuation *continuation = continuation_top;
+#endif
 
   va_start (args, msg);
   fprintf (stderr, "error: %s", msg);
@@ -333,6 +337,9 @@ marlais_error (char *msg,...)
       pop_scope ();
       error_ok_return_pop ();
     } else {
+#ifdef USE_CONTINUATION_STACK
+      continuation_top = continuation;
+#endif
       return ret;
     }
   }
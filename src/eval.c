@@ -13,9 +13,16 @@
 #include "syntax.h"
 
 struct eval_stack *eval_stack = 0;
+struct eval_stack *eval_stack_base = 0;
+int eval_stack_depth = 0;
+static int eval_stack_size = 0;
+
+#define EVAL_STACK_INITIAL_SIZE 256
 
 /* local function prototypes */
-Object eval_combination (Object obj, int do_apply);
+Object eval_combination (Object obj, Object fun, int argc, Object *argv);
+static Object *eval_operands (Object operands, int *argc, Object *buf);
+static Object *tail_args (int *argc, Object *buf);
 
 /* function definitions */
 
@@ -68,14 +75,30 @@ eval (Object obj)
 	}
 	return (val);
     case Pair:
-	return (eval_combination (obj, 0));
+	return (eval_combination (obj, NULL, 0, NULL));
+    case Code:
+	if (CODEKIND (obj) == ConstantCode) {
+	    return (CODEVALUE (obj));
+	}
+	return (eval_combination (obj, NULL, 0, NULL));
     default:
 	return marlais_error ("eval: do not know how to eval object", obj, NULL);
     }
 }
 
-jmp_buf *the_eval_context = NULL;
-static Object the_eval_obj = NULL;
+/* a tail call leaves what it wants done here and returns
+   tail_call_object, which its callers hand straight back until it
+   reaches the combination it replaces.  that combination then does
+   the call in a loop, so tail calls take no C stack and no setjmp. */
+Object tail_call_object;
+static Object tail_obj;		/* form to evaluate, NULL to apply */
+static struct frame *tail_env;	/* environment to evaluate it in */
+static Object tail_fun;
+static Object *tail_argv;
+static int tail_argc;
+#ifdef OPTIMIZE_TAIL_CALLS
+static int tail_argv_size;
+#endif
 
 extern struct frame *the_env;
 
@@ -85,93 +108,144 @@ tail_eval (Object obj)
 
 #ifdef OPTIMIZE_TAIL_CALLS
     if (trace_functions) {
+	/* the top record has no parent at depth 1 */
 	marlais_warning ("in tail eval context, parent context",
 		 eval_stack->context,
-		 eval_stack->next->context,
+		 eval_stack_depth > 1 ? eval_stack[-1].context : NULL,
 		 0);
     }
-    if (PAIRP (obj)) {
-	the_eval_obj = obj;
-	if (the_eval_context == NULL) {
-	    marlais_error ("tail_eval called without a prior eval in progress.", NULL);
-	}
-	longjmp (*the_eval_context, 1);
+    if (PAIRP (obj) || (CODEP (obj) && CODEKIND (obj) != ConstantCode)) {
+	tail_obj = obj;
+	tail_env = the_env;
+	return (tail_call_object);
     }
 #endif
     /* if it's not a <pair>, then call good old eval. */
     return eval (obj);
 }
 
+/* apply fun to the argc arguments in argv in place of the current
+   combination.  argv is copied, it need not outlive the caller. */
+Object
+tail_apply (Object fun, int argc, Object *argv)
+{
+#ifdef OPTIMIZE_TAIL_CALLS
+    int i;
+
+    if (argc > tail_argv_size) {
+	tail_argv_size = argc + MAX_STACK_ARGS;
+	tail_argv = (Object *)
+	    marlais_allocate_memory (tail_argv_size * sizeof (Object));
+    }
+    for (i = 0; i < argc; ++i) {
+	tail_argv[i] = argv[i];
+    }
+    tail_argc = argc;
+    tail_fun = fun;
+    tail_obj = NULL;
+    return (tail_call_object);
+#else
+    return apply_argv (fun, argc, argv);
+#endif
+}
+
 /* <pcb> moved apply here to permit safe tail recursion. */
 
 Object
 apply (Object fun, Object args)
 {
-    return eval_combination (cons (fun, args), 1);
+    Object buf[MAX_STACK_ARGS];
+    Object *argv;
+    int argc;
+
+    argv = list_to_array (args, &argc, buf, MAX_STACK_ARGS);
+    return eval_combination (NULL, fun, argc, argv);
+}
+
+/* apply fun to the argc arguments in argv, which it may overwrite. */
+Object
+apply_argv (Object fun, int argc, Object *argv)
+{
+    return eval_combination (NULL, fun, argc, argv);
 }
 
+/* evaluate the combination obj, or when obj is NULL apply fun to
+   the argc arguments in argv.  arguments are evaluated into an
+   array on the C stack; lists are made only for #rest parameters. */
 Object
-eval_combination (Object obj, int do_apply)
+eval_combination (Object obj, Object fun, int argc, Object *argv)
 {
     Object op;
     syntax_fun sf;
-    Object fun, args, ret;
+    Object ret;
+    Object buf[MAX_STACK_ARGS];
     struct frame *old_env;
-    struct eval_stack *old_stack;
-    jmp_buf *old_context;
-    jmp_buf this_context;
     int is_tail_call = 0;
+    int old_results;
     Object tail_required_values;
     Object tail_rest_values;
 
-    ResultValueStack = cons (default_result_value (), ResultValueStack);
+    old_results = result_types_depth;
+    push_result_types ();
 
     old_env = the_env;
-    old_stack = eval_stack;
-
-    /* save a place for tail_eval to longjmp to later. */
-    old_context = the_eval_context;
-    the_eval_context = &this_context;
-    if (setjmp (this_context) != 0) {
-	obj = the_eval_obj;
 
-	eval_stack = old_stack;	/* restore the state of the "eval" stack. */
-
-	is_tail_call = 1;	/* a tail call occurred. */
-	do_apply = 0;		/* tail_eval called from apply. */
-    }
-    if (do_apply) {
-	fun = CAR (obj);
-	args = CDR (obj);
-	push_eval_stack (fun);
-	ret = apply_internal (fun, args);
-	pop_eval_stack ();
-    } else {
-	op = CAR (obj);
-	sf = syntax_function (op);
-	if (sf) {
-	    push_eval_stack (op);
-	    ret = (*sf) (obj);
-	    pop_eval_stack ();
-	} else {
-	    fun = eval (CAR (obj));
+    for (;;) {
+	if (obj == NULL) {
 	    push_eval_stack (fun);
-	    args = map (eval, CDR (obj));
-	    ret = apply_internal (fun, args);
+	    ret = apply_internal (fun, argc, argv);
 	    pop_eval_stack ();
+	} else if (CODEP (obj)) {
+	    /* pre-analyzed form: the syntax function or call is known. */
+	    if (CODEKIND (obj) == SyntaxCode) {
+		push_eval_stack (CAR (CODEFORM (obj)));
+		ret = (*CODESYNTAX (obj)) (CODEFORM (obj));
+		pop_eval_stack ();
+	    } else {
+		fun = eval (CODEOPERATOR (obj));
+		push_eval_stack (fun);
+		argv = eval_operands (CODEOPERANDS (obj), &argc, buf);
+		ret = apply_internal (fun, argc, argv);
+		pop_eval_stack ();
+	    }
+	} else {
+	    op = CAR (obj);
+	    sf = syntax_function (op);
+	    if (sf) {
+		push_eval_stack (op);
+		ret = (*sf) (obj);
+		pop_eval_stack ();
+	    } else {
+		fun = eval (CAR (obj));
+		push_eval_stack (fun);
+		argv = eval_operands (CDR (obj), &argc, buf);
+		ret = apply_internal (fun, argc, argv);
+		pop_eval_stack ();
+	    }
+	}
+	if (ret != tail_call_object) {
+	    break;
+	}
+	/* a tail call occurred: make it in place of the one returning. */
+	is_tail_call = 1;
+	obj = tail_obj;
+	if (obj == NULL) {
+	    fun = tail_fun;
+	    argv = tail_args (&argc, buf);
+	} else {
+	    the_env = tail_env;
 	}
     }
 
-    /* restore previous frame's context. */
-    the_eval_context = old_context;
-
     /* here we restore the environment since is not restored via tail calls. */
     if (is_tail_call)
 	the_env = old_env;
 
-    tail_required_values = CAR (CAR (ResultValueStack));
-    tail_rest_values = CDR (CAR (ResultValueStack));
-    ResultValueStack = CDR (ResultValueStack);
+    /* pop this combination's result types and any left by a non-local
+       exit out of the combinations it evaluated. */
+    tail_required_values = result_types[old_results].required;
+    tail_rest_values = result_types[old_results].rest;
+    result_types_depth = old_results;
 
     ret = construct_return_values (ret,
 				   tail_required_values,
@@ -179,35 +253,123 @@ eval_combination (Object obj, int do_apply)
     return ret;
 }
 
+#ifdef USE_CONTINUATION_STACK
+/* carry out the last tail call up to the function it applies: run
+   the form it left, and the tail calls that makes, until one is a
+   function to apply to arguments.  they are put in *fun, *argc and
+   *argv, in buf if they fit, and tail_call_object is returned; if
+   the form gives a value instead, that is returned. */
+Object
+tail_call_function (Object *fun, int *argc, Object **argv, Object *buf)
+{
+    Object obj, ret;
+    syntax_fun sf;
+
+    for (;;) {
+	obj = tail_obj;
+	if (obj == NULL) {
+	    *fun = tail_fun;
+	    *argv = tail_args (argc, buf);
+	    return (tail_call_object);
+	}
+	the_env = tail_env;
+	if (CODEP (obj)) {
+	    if (CODEKIND (obj) != SyntaxCode) {
+		*fun = eval (CODEOPERATOR (obj));
+		*argv = eval_operands (CODEOPERANDS (obj), argc, buf);
+		return (tail_call_object);
+	    }
+	    push_eval_stack (CAR (CODEFORM (obj)));
+	    ret = (*CODESYNTAX (obj)) (CODEFORM (obj));
+	    pop_eval_stack ();
+	} else {
+	    sf = syntax_function (CAR (obj));
+	    if (!sf) {
+		*fun = eval (CAR (obj));
+		*argv = eval_operands (CDR (obj), argc, buf);
+		return (tail_call_object);
+	    }
+	    push_eval_stack (CAR (obj));
+	    ret = (*sf) (obj);
+	    pop_eval_stack ();
+	}
+	if (ret != tail_call_object) {
+	    return (ret);
+	}
+    }
+}
+#endif
+
+/* the arguments tail_apply left, in buf if they fit. */
+static Object *
+tail_args (int *argc, Object *buf)
+{
+    Object *argv;
+    int i;
+
+    *argc = tail_argc;
+    argv = (*argc <= MAX_STACK_ARGS) ? buf
+	: (Object *) marlais_allocate_memory (*argc * sizeof (Object));
+    for (i = 0; i < *argc; ++i) {
+	argv[i] = tail_argv[i];
+    }
+    return argv;
+}
+
+/* evaluate operands left to right into buf, or into fresh memory
+   when there are more than MAX_STACK_ARGS of them. */
+static Object *
+eval_operands (Object operands, int *argc, Object *buf)
+{
+    Object *argv;
+    int i;
+
+    *argc = list_length (operands);
+    argv = (*argc <= MAX_STACK_ARGS) ? buf
+	: (Object *) marlais_allocate_memory (*argc * sizeof (Object));
+    for (i = 0; PAIRP (operands); operands = CDR (operands)) {
+	argv[i++] = eval (CAR (operands));
+    }
+    return argv;
+}
+
 void
 pop_eval_stack (void)
 {
-    eval_stack = eval_stack->next;
+    set_eval_stack_depth (eval_stack_depth - 1);
 }
 
 void
 push_eval_stack (Object obj)
 {
-    struct eval_stack *tmp =
-    (struct eval_stack *) marlais_allocate_memory (sizeof (struct eval_stack));
+    if (eval_stack_depth == eval_stack_size) {
+	eval_stack_size = (eval_stack_size ? 2 * eval_stack_size
+			   : EVAL_STACK_INITIAL_SIZE);
+	eval_stack_base = (struct eval_stack *)
+	    marlais_reallocate_memory (eval_stack_base,
+				       eval_stack_size * sizeof (struct eval_stack));
+    }
+    eval_stack = &eval_stack_base[eval_stack_depth++];
+    eval_stack->context = obj;
+    eval_stack->frame = the_env;
+}
 
-    tmp->next = eval_stack;
-    tmp->context = obj;
-    tmp->frame = the_env;
-    eval_stack = tmp;
+void
+set_eval_stack_depth (int depth)
+{
+    eval_stack_depth = depth;
+    eval_stack = depth ? &eval_stack_base[depth - 1] : NULL;
 }
 
 Object
 print_stack (void)
 {
-    struct eval_stack *entry;
-    int i;
+    int i, depth;
 
-    for (i = 0, entry = eval_stack->next;
-	 entry != NULL;
-	 entry = entry->next, i++) {
+    for (i = 0, depth = eval_stack_depth - 2; depth >= 0; depth--, i++) {
 	fprintf (stderr, "#%d ", i);
-	marlais_print_object (marlais_standard_error, entry->context, 1);
+	marlais_print_object (marlais_standard_error,
+			      eval_stack_base[depth].context, 1);
 	fprintf (stderr, "\n");
     }
     return unspecified_object;
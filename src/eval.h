@@ -40,18 +40,28 @@
 Object eval (Object obj);
 Object print_stack (void);
 
+/* the eval stack is an array of records, eval_stack_base[0] at the
+   bottom; eval_stack points at the top one, or is NULL when empty.
+   the array moves when it grows, so hold on to depths, not records. */
 struct eval_stack {
-    struct eval_stack *next;
     Object context;
     struct frame *frame;
 };
 
 extern struct eval_stack *eval_stack;
+extern struct eval_stack *eval_stack_base;
+extern int eval_stack_depth;
 
 void pop_eval_stack (void);
 void push_eval_stack (Object obj);
+void set_eval_stack_depth (int depth);
 
 /* <pcb> to support tail recursion. */
+extern Object tail_call_object;
 Object tail_eval (Object obj);
+Object tail_apply (Object fun, int argc, Object *argv);
+#ifdef USE_CONTINUATION_STACK
+Object tail_call_function (Object *fun, int *argc, Object **argv, Object *buf);
+#endif
 
 #endif
@@ -4,6 +4,7 @@
 
 #include "file.h"
 
+#include "analyze.h"
 #include "dylan_lexer.h"
 #include "env.h"
 #include "eval.h"
@@ -64,7 +65,7 @@ i_load (Object filename)
     close_file (fp);
 
     while (PAIRP (expr_list)) {
-	res = eval (CAR (expr_list));
+	res = eval (analyze (CAR (expr_list)));
 	expr_list = CDR (expr_list);
     }
 
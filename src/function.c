@@ -36,7 +36,9 @@
 #include "function.h"
 
 #include "alloc.h"
+#include "analyze.h"
 #include "apply.h"
+#include "bytecode.h"
 #include "class.h"
 #include "env.h"
 #include "error.h"
@@ -57,7 +59,8 @@ extern Object x_symbol;
 static Object generic_function_make (Object arglist);
 static Object generic_function_mandatory_keywords (Object generic);
 static Object function_values (Object func);
-static Object make_specializers_from_params (Object);
+static struct signature *make_signature (Object params, Object rest,
+				        Object keys, int all_keys);
 static Object function_arguments (Object fun);
 static int possible_method (Object meth, Object class_list);
 static Object user_applicable_method_p (Object fun, Object sample_args);
@@ -65,13 +68,17 @@ static Object split_sorted_methods (Object methods, Object sample_args);
 static Object build_sorted_handles (Object methods, Object current_group);
 static Object sort_methods (Object methods, Object sample_args);
 static int sort_driver (Object *pmeth1, Object *pmeth2);
-static int same_specializers (Object s1, Object s2);
-static int specializer_compare (Object spec1, Object spec2);
+static int same_specializers (int num1, Object *specs1,
+			      int num2, Object *specs2);
+static int specializer_compare (struct signature *sig1,
+				struct signature *sig2);
 static Object find_method (Object generic, Object spec_list);
 static Object remove_method (Object generic, Object method);
 static Object debug_name_setter (Object method, Object name);
 static int is_param_name (Object parameter_name);
 static Object param_name_to_keyword (Object param_name);
+static int mentions_symbol (Object form, Object sym);
+static struct keyword_index *make_keyword_index (Object keys);
 
 
 /* primitives */
@@ -408,10 +415,12 @@ make_generic_function (Object name, Object params, Object methods)
 
     GFNAME (obj) = name;
     parse_generic_function_parameters (obj, params);
+    GFSIG (obj) = make_signature (GFREQPARAMS (obj), GFRESTPARAM (obj),
+				  GFKEYPARAMS (obj), GFALLKEYS (obj));
     GFMETHODS (obj) = methods;
 
 #ifdef USE_METHOD_CACHING
-    GFCACHE (obj) = make_table (50);	/* Maybe make 50 a define? */
+    GFDISPATCH (obj) = NULL;
     GFACTIVENM (obj) = make_empty_list ();
 #endif
 
@@ -515,8 +524,25 @@ make_method (Object name, Object params, Object body, struct frame *env, int do_
 	METHNAME (obj) = NULL;
     }
     parse_method_parameters (obj, params);
-    METHBODY (obj) = body;
+    METHSIG (obj) = make_signature (METHREQPARAMS (obj), METHRESTPARAM (obj),
+				    METHKEYPARAMS (obj), METHALLKEYS (obj));
+    /* a body or keyword default that never names next-method, even
+       from a closure, gets no next-method object or binding. */
+    if (!mentions_symbol (body, METHNEXTMETH (obj))
+	&& !mentions_symbol (METHKEYPARAMS (obj), METHNEXTMETH (obj))) {
+	METHNEXTMETH (obj) = NULL;
+    }
+    METHKEYINDEX (obj) = make_keyword_index (METHKEYPARAMS (obj));
+    /* room for every parameter, see apply_method */
+    METHFRAMESIZE (obj) = list_length (METHREQPARAMS (obj))
+	+ (METHRESTPARAM (obj) ? 1 : 0)
+	+ (METHNEXTMETH (obj) ? 1 : 0)
+	+ list_length (METHKEYPARAMS (obj));
+    METHBODY (obj) = analyze_body (body);
     METHENV (obj) = env;
+#ifdef USE_BYTECODE
+    METHCODE (obj) = compile_method (obj);
+#endif
 
 #ifdef USE_METHOD_CACHING
     /* create my handle (will redo if replacing existing method) */
@@ -538,6 +564,23 @@ make_method (Object name, Object params, Object body, struct frame *env, int do_
     }
 }
 
+/* does sym appear anywhere in the form?  a method form evaluated
+   before has its body analyzed in place into code nodes, each of which
+   keeps the form it came from. */
+static int
+mentions_symbol (Object form, Object sym)
+{
+    if (CODEP (form)) {
+	return (mentions_symbol (CODEFORM (form), sym));
+    }
+    for (; PAIRP (form); form = CDR (form)) {
+	if (mentions_symbol (CAR (form), sym)) {
+	    return 1;
+	}
+    }
+    return (form == sym);
+}
+
 Object
 make_next_method (Object generic, Object rest_methods, Object args)
 {
@@ -597,10 +640,12 @@ generic_function_make (Object arglist)
     } else {
 	GFPROPS (obj) |= GFALLKEYSMASK;
     }
+    GFSIG (obj) = make_signature (GFREQPARAMS (obj), GFRESTPARAM (obj),
+				  GFKEYPARAMS (obj), GFALLKEYS (obj));
     GFMETHODS (obj) = make_empty_list ();
 
 #ifdef USE_METHOD_CACHING
-    GFCACHE (obj) = make_table (50);	/* Maybe make 50 a define? */
+    GFDISPATCH (obj) = NULL;
     GFACTIVENM (obj) = make_empty_list ();
 #endif
 
@@ -616,24 +661,23 @@ make_generic_function_driver (Object args)
 
 /* local functions */
 
-/* compare specializer lists s1 and s2 to see if each specializer in s1
- * is a subclass of the corresponding specializer in s2
- * list lengths are also compared.
+/* compare the specializers of signatures s1 and s2 to see if each
+ * specializer in s1 is a subclass of the corresponding specializer
+ * in s2.  their numbers are also compared.
  */
 static int
-sub_specializers (Object s1, Object s2)
+sub_specializers (struct signature *s1, struct signature *s2)
 {
-    while (!EMPTYLISTP (s1) && !EMPTYLISTP (s2)) {
-	if (!subtype (CAR (s1), CAR (s2))) {
+    int i;
+
+    if (s1->required != s2->required) {
+	return (0);
+    }
+    for (i = 0; i < s1->required; ++i) {
+	if (!subtype (s1->specializers[i], s2->specializers[i])) {
 	    return (0);
 	}
-	s1 = CDR (s1);
-	s2 = CDR (s2);
     }
-
-    if (!EMPTYLISTP (s1) || !EMPTYLISTP (s2))
-	return (0);
-
     return (1);
 }
 
@@ -643,12 +687,10 @@ sub_specializers (Object s1, Object s2)
 Object
 add_method (Object generic, Object method)
 {
-    Object new_specs, old_specs, methods, last, old_method, next_meth_list;
+    Object methods, last, old_method, next_meth_list;
+    struct signature *new_sig, *old_sig;
 
-    new_specs = function_specializers (method);
-
-/* check method for fit with generic specializers */
-    old_specs = function_specializers (generic);
+    new_sig = METHSIG (method);
 
 #ifdef USE_METHOD_CACHING
     /* invalidate next methods when new method added. */
@@ -660,7 +702,8 @@ add_method (Object generic, Object method)
     }
 #endif
 
-    if (!sub_specializers (new_specs, old_specs)) {
+    /* check method for fit with generic specializers */
+    if (!sub_specializers (new_sig, GFSIG (generic))) {
 	marlais_error ("add-method: method specializers must be subtypes of generic func. specs.", method, NULL);
     }
     if (!GFRESTPARAM (generic) && METHRESTPARAM (method)) {
@@ -671,14 +714,17 @@ add_method (Object generic, Object method)
     methods = GFMETHODS (generic);
     last = 0;
     while (!EMPTYLISTP (methods)) {
-	old_specs = function_specializers (CAR (methods));
-	if (same_specializers (new_specs, old_specs)) {
+	old_sig = METHSIG (CAR (methods));
+	if (same_specializers (new_sig->required, new_sig->specializers,
+			       old_sig->required, old_sig->specializers)) {
 	    old_method = CAR (methods);
 
 #ifdef USE_METHOD_CACHING
 	    METHHANDLE (method) = METHHANDLE (old_method);
 	    HDLOBJ (METHHANDLE (method)) = method;
+	    GFDISPATCH (generic) = NULL;
 #endif
+	    ++dispatch_epoch;
 
 	    if (!last) {
 		GFMETHODS (generic) = cons (method, CDR (methods));
@@ -694,9 +740,10 @@ add_method (Object generic, Object method)
     GFMETHODS (generic) = cons (method, GFMETHODS (generic));
 
 #ifdef USE_METHOD_CACHING
-    /* Invalidate the method cache */
-    GFCACHE (generic) = make_table (50);
+    /* Invalidate the dispatch tree, it is rebuilt as calls need it */
+    GFDISPATCH (generic) = NULL;
 #endif
+    ++dispatch_epoch;
 
     return (construct_values (2, method, MARLAIS_FALSE));
 }
@@ -719,18 +766,21 @@ generic_function_mandatory_keywords (Object generic)
 Object
 function_specializers (Object func)
 {
-    Object params;
+    struct signature *sig;
 
-    if (METHODP (func)) {
-	params = METHREQPARAMS (func);
-    } else if (GFUNP (func)) {
-	params = GFREQPARAMS (func);
-    } else {
+    if (!METHODP (func) && !GFUNP (func)) {
 	marlais_error ("function-specializers: arg. must be a method or generic function",
 	       func,
 	       NULL);
     }
-    return make_specializers_from_params (params);
+    sig = function_signature (func);
+    return list_from_array (sig->required, sig->specializers);
+}
+
+struct signature *
+function_signature (Object fun)
+{
+    return (METHODP (fun) ? METHSIG (fun) : GFSIG (fun));
 }
 
 static Object
@@ -755,19 +805,90 @@ function_values (Object func)
 
 }
 
-static Object
-make_specializers_from_params (Object params)
+static struct signature *
+make_signature (Object params, Object rest, Object keys, int all_keys)
 {
-    Object specs, *tmp_ptr;
+    struct signature *sig;
+    int i;
+
+    sig = MARLAIS_ALLOCATE_STRUCT (struct signature);
+    sig->required = list_length (params);
+    sig->specializers = (Object *)
+	marlais_allocate_memory (sig->required * sizeof (Object));
+    for (i = 0; PAIRP (params); ++i, params = CDR (params)) {
+	sig->specializers[i] = SECOND (CAR (params));
+    }
+    sig->rest = (rest != NULL);
+    sig->keywords = all_keys ? all_symbol : keys;
+    return (sig);
+}
 
-    for (specs = make_empty_list (), tmp_ptr = &specs;
-	 PAIRP (params);
-	 tmp_ptr = &CDR (*tmp_ptr), params = CDR (params)) {
-	*tmp_ptr = cons (SECOND (CAR (params)), make_empty_list ());
+/* index keys, a list of (keyword var default), or NULL if empty. */
+static struct keyword_index *
+make_keyword_index (Object keys)
+{
+    struct keyword_index *index;
+    struct key_param *param;
+    Object init;
+    int i, j, k;
 
+    if (!PAIRP (keys)) {
+	return (NULL);
     }
-    return (specs);
+    index = MARLAIS_ALLOCATE_STRUCT (struct keyword_index);
+    index->count = list_length (keys);
+    index->params = (struct key_param *)
+	marlais_allocate_memory (index->count * sizeof (struct key_param));
+    index->by_keyword = (int *)
+	marlais_allocate_memory (index->count * sizeof (int));
+    for (i = 0; PAIRP (keys); ++i, keys = CDR (keys)) {
+	param = &index->params[i];
+	param->keyword = FIRST (CAR (keys));
+	param->var = SECOND (CAR (keys));
+	init = THIRD (CAR (keys));
+	if (PAIRP (init) && CAR (init) == quote_symbol) {
+	    param->init = SECOND (init);
+	    param->constant = 1;
+	} else {
+	    param->init = init;
+	    param->constant = self_evaluating_p (init);
+	}
+
+	/* insertion sort on keyword address */
+	for (j = i; j > 0; --j) {
+	    k = index->by_keyword[j - 1];
+	    if ((unsigned long) index->params[k].keyword
+		< (unsigned long) param->keyword) {
+		break;
+	    }
+	    index->by_keyword[j] = k;
+	}
+	index->by_keyword[j] = i;
+    }
+    return (index);
+}
 
+/* the frame position of keyword's parameter, or -1. */
+int
+keyword_position (struct keyword_index *index, Object keyword)
+{
+    int lo, hi, mid, k;
+
+    lo = 0;
+    hi = index->count - 1;
+    while (lo <= hi) {
+	mid = (lo + hi) / 2;
+	k = index->by_keyword[mid];
+	if (index->params[k].keyword == keyword) {
+	    return (k);
+	} else if ((unsigned long) index->params[k].keyword
+		   < (unsigned long) keyword) {
+	    lo = mid + 1;
+	} else {
+	    hi = mid - 1;
+	}
+    }
+    return (-1);
 }
 
 /*
@@ -780,42 +901,21 @@ make_specializers_from_params (Object params)
 static Object
 function_arguments (Object fun)
 {
-    Object params, keywords;
-    Object has_rest;
+    struct signature *sig;
 
     switch (POINTERTYPE (fun)) {
     case GenericFunction:
-	params = GFREQPARAMS (fun);
-	if (GFALLKEYS (fun)) {
-	    keywords = all_symbol;
-	} else {
-	    keywords = GFKEYPARAMS (fun);
-	}
-	if (GFRESTPARAM (fun)) {
-	    has_rest = MARLAIS_TRUE;
-	} else {
-	    has_rest = MARLAIS_FALSE;
-	}
-	break;
     case Method:
-	params = METHREQPARAMS (fun);
-	if (METHALLKEYS (fun)) {
-	    keywords = all_symbol;
-	} else {
-	    keywords = METHKEYPARAMS (fun);
-	}
-	if (METHRESTPARAM (fun)) {
-	    has_rest = MARLAIS_TRUE;
-	} else {
-	    has_rest = MARLAIS_FALSE;
-	}
+	sig = function_signature (fun);
 	break;
     case Primitive:
-	marlais_error ("function-arguments: cannot query arguments of a primitive", fun, NULL);
+	return marlais_error ("function-arguments: cannot query arguments of a primitive", fun, NULL);
     default:
-	marlais_error ("function-arguments: bad argument", fun, NULL);
+	return marlais_error ("function-arguments: bad argument", fun, NULL);
     }
-    return (construct_values (3, list_length_int (params), has_rest, keywords));
+    return (construct_values (3, marlais_make_integer (sig->required),
+			      sig->rest ? MARLAIS_TRUE : MARLAIS_FALSE,
+			      sig->keywords));
 }
 
 static int
@@ -848,7 +948,8 @@ user_applicable_method_p (Object argfun, Object sample_args)
 Object
 applicable_method_p (Object argfun, Object sample_args, int strict_check)
 {
-    Object args, specs, samples, keywords;
+    Object samples, keywords;
+    struct signature *sig;
     int num_required, i, check_keywords = 1;
     Object funs, fun;
 
@@ -869,11 +970,10 @@ applicable_method_p (Object argfun, Object sample_args, int strict_check)
     while (PAIRP (funs)) {
 	fun = CAR (funs);
 	funs = CDR (funs);
-	args = function_arguments (fun);
-	specs = function_specializers (fun);
+	sig = function_signature (fun);
 
 	/* Are there more sample args than required args? */
-	num_required = INTVAL (FIRSTVAL (args));
+	num_required = sig->required;
 	if (list_length (sample_args) < num_required) {
 	    return (MARLAIS_FALSE);
 	}
@@ -881,16 +981,15 @@ applicable_method_p (Object argfun, Object sample_args, int strict_check)
 	   types of the sample args? */
 	samples = sample_args;
 	for (i = 0; i < num_required; ++i) {
-	    if (!instance (CAR (samples), CAR (specs))) {
+	    if (!instance (CAR (samples), sig->specializers[i])) {
 		goto fail;
 /*              return (MARLAIS_FALSE); */
 	    }
 	    samples = CDR (samples);
-	    specs = CDR (specs);
 	}
 
 	if (PAIRP (samples)) {
-	  keywords = THIRDVAL (args);
+	  keywords = sig->keywords;
 	  /* If the method accepts keywords, make sure supplied keywords match */
 	    if (PAIRP (keywords) || keywords == all_symbol) {
 		if (keywords == all_symbol) {
@@ -916,7 +1015,7 @@ applicable_method_p (Object argfun, Object sample_args, int strict_check)
 		    }
 		    samples = CDR (CDR (samples));
 		}
-	    } else if (SECONDVAL (args) == MARLAIS_FALSE) {
+	    } else if (!sig->rest) {
 		/* We have no rest parameter.  If there are more arguments, this
 		 * ain't a match.
 		 */
@@ -928,6 +1027,38 @@ applicable_method_p (Object argfun, Object sample_args, int strict_check)
     }
 }
 
+/* applicable_method_p (meth, args, 0) for the argc arguments in argv,
+   as generic function dispatch asks it. */
+int
+applicable_method_argv (Object meth, int argc, Object *argv)
+{
+    struct signature *sig;
+    int i;
+
+    sig = METHSIG (meth);
+    if (argc < sig->required) {
+	return 0;
+    }
+    for (i = 0; i < sig->required; ++i) {
+	if (!instance (argv[i], sig->specializers[i])) {
+	    return 0;
+	}
+    }
+    if (i < argc) {
+	/* the rest must be keyword arguments, or go to a #rest */
+	if (sig->keywords == all_symbol || PAIRP (sig->keywords)) {
+	    for (; i < argc; i += 2) {
+		if (!KEYWORDP (argv[i]) || i + 1 == argc) {
+		    return 0;
+		}
+	    }
+	} else if (!sig->rest) {
+	    return 0;
+	}
+    }
+    return 1;
+}
+
 #ifdef USE_METHOD_CACHING
 Object
 recalc_next_methods (Object fun, Object meth, Object sample_args)
@@ -994,8 +1125,8 @@ build_sorted_handles (Object methods, Object current_group)
     }
     /* add to current group or build new group into list */
     if (EMPTYLISTP (current_group) ||
-	specializer_compare (function_specializers (HDLOBJ (CAR (current_group))),
-			     function_specializers (CAR (methods))) == 0) {
+	specializer_compare (METHSIG (HDLOBJ (CAR (current_group))),
+			     METHSIG (CAR (methods))) == 0) {
 	return (build_sorted_handles (CDR (methods),
 			 cons (METHHANDLE (CAR (methods)), current_group)));
     } else {
@@ -1032,27 +1163,24 @@ possible_method (Object meth, Object class_list)
 /* detect whether this is a possible method for this list of classes of
    specializers */
 {
-    Object args, specs, samples;
-    int num_required, i;
-
-    args = function_arguments (meth);
-    specs = function_specializers (meth);
+    struct signature *sig;
+    Object samples;
+    int i;
 
     /* Are there more sample args than required args?
      */
-    num_required = INTVAL (FIRSTVAL (args));
-    if (list_length (class_list) < num_required) {
+    sig = METHSIG (meth);
+    if (list_length (class_list) < sig->required) {
 	return (0);
     }
     /* Are the classes of the required args supertypes of the
      * class list? */
     samples = class_list;
-    for (i = 0; i < num_required; ++i) {
-	if (!subtype (CAR (samples), broad_class (CAR (specs)))) {
+    for (i = 0; i < sig->required; ++i) {
+	if (!subtype (CAR (samples), broad_class (sig->specializers[i]))) {
 	    return (0);
 	}
 	samples = CDR (samples);
-	specs = CDR (specs);
     }
 
     /* We passed all of the tests. */
@@ -1077,8 +1205,7 @@ sorted_possible_method_handles (Object fun, Object sample_args)
     Object methods, maybe_methods, sorted_methods, sorted_handles, method,
       class_list;
 
-    class_list = make_class_list (sample_args,
-			      INTVAL (FIRSTVAL (function_arguments (fun))));
+    class_list = make_class_list (sample_args, GFSIG (fun)->required);
     methods = GFMETHODS (fun);
     maybe_methods = make_empty_list ();
     while (!EMPTYLISTP (methods)) {
@@ -1131,8 +1258,8 @@ split_sorted_methods (Object methods, Object sample_args)
     for (prev_ptr = &methods, next = CDR (methods);
 	 PAIRP (next);
 	 prev_ptr = &CDR (*prev_ptr), next = CDR (next)) {
-	if (specializer_compare (function_specializers (CAR (*prev_ptr)),
-				 function_specializers (CAR (next))) == 0) {
+	if (specializer_compare (METHSIG (CAR (*prev_ptr)),
+				 METHSIG (CAR (next))) == 0) {
 	    next = *prev_ptr;
 	    *prev_ptr = make_empty_list ();
 	    break;
@@ -1173,42 +1300,38 @@ sort_methods (Object methods, Object sample_args)
 static int
 sort_driver (Object *pmeth1, Object *pmeth2)
 {
-    Object specs1, specs2;
-
-    specs1 = function_specializers (*pmeth1);
-    specs2 = function_specializers (*pmeth2);
-    return specializer_compare (specs1, specs2);
+    return specializer_compare (METHSIG (*pmeth1), METHSIG (*pmeth2));
 }
 
-/* It is assumed that s1 and s2 have the same length. */
 static int
-same_specializers (Object s1, Object s2)
+same_specializers (int num1, Object *specs1, int num2, Object *specs2)
 {
-    while (!EMPTYLISTP (s1) && !EMPTYLISTP (s2)) {
-	if (same_class_p (CAR (s1), CAR (s2)) == MARLAIS_FALSE) {
+    int i;
+
+    if (num1 != num2) {
+	return (0);
+    }
+    for (i = 0; i < num1; ++i) {
+	if (same_class_p (specs1[i], specs2[i]) == MARLAIS_FALSE) {
 	    return (0);
 	}
-	s1 = CDR (s1);
-	s2 = CDR (s2);
     }
-    if (!EMPTYLISTP (s1) || !EMPTYLISTP (s2))
-	return (0);
     return (1);
 }
 
+/* It is assumed that sig1 and sig2 have as many specializers. */
 static int
-specializer_compare (Object s1, Object s2)
+specializer_compare (struct signature *sig1, struct signature *sig2)
 {
-    Object spec1, spec2, arg, specs1, specs2, args, class_list;
+    Object spec1, spec2, arg, args, class_list;
     int ret = 0;
+    int i;
 
-    specs1 = s1;
-    specs2 = s2;
     args = sort_driver_args____;
 
-    while (!EMPTYLISTP (specs1)) {
-	spec1 = CAR (specs1);
-	spec2 = CAR (specs2);
+    for (i = 0; i < sig1->required; ++i) {
+	spec1 = sig1->specializers[i];
+	spec2 = sig2->specializers[i];
 	arg = CAR (args);
 
 	if (spec1 == spec2) {
@@ -1259,8 +1382,6 @@ specializer_compare (Object s1, Object s2)
 	    /* These are ambiguous according to Design Note 8 */
 	    return 0;
 	}
-	specs1 = CDR (specs1);
-	specs2 = CDR (specs2);
 	args = CDR (args);
     }
     return ret;
@@ -1269,13 +1390,17 @@ specializer_compare (Object s1, Object s2)
 static Object
 find_method (Object generic, Object spec_list)
 {
-    Object methods;
+    Object methods, buf[MAX_STACK_ARGS], *specs;
+    struct signature *sig;
+    int num;
 
+    specs = list_to_array (spec_list, &num, buf, MAX_STACK_ARGS);
     for (methods = GFMETHODS (generic);
 	 PAIRP (methods);
 	 methods = CDR (methods)) {
-	if (same_specializers (function_specializers (CAR (methods)),
-			       spec_list)) {
+	sig = METHSIG (CAR (methods));
+	if (same_specializers (sig->required, sig->specializers,
+			       num, specs)) {
 	    return CAR (methods);
 	}
     }
@@ -1293,6 +1418,10 @@ remove_method (Object generic, Object method)
 	/* need to add test for sealed function, when available */
 	if (method == CAR (*tmp_ptr)) {
 	    *tmp_ptr = CDR (*tmp_ptr);
+#ifdef USE_METHOD_CACHING
+	    GFDISPATCH (generic) = NULL;
+#endif
+	    ++dispatch_epoch;
 	    return method;
 	}
     }
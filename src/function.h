@@ -39,6 +39,31 @@
 /* global objects */
 extern Object allkeys_symbol, all_symbol;
 
+/* the parameters of a method or generic function as dispatch looks
+   at them, worked out once when it is made. */
+struct signature {
+    int required;		/* number of required parameters */
+    Object *specializers;	/* the type of each */
+    int rest;			/* takes #rest */
+    Object keywords;		/* key parameters, or all_symbol */
+};
+
+/* a method's keyword parameters laid out for enter_method: params
+   are in frame order and by_keyword lists them sorted on keyword, so
+   a supplied keyword finds its slot by binary search. */
+struct key_param {
+    Object keyword;
+    Object var;			/* symbol or (symbol type) */
+    Object init;		/* default expression, or its value */
+    int constant;		/* init needs no evaluation */
+};
+
+struct keyword_index {
+    int count;
+    struct key_param *params;
+    int *by_keyword;
+};
+
 void init_function_prims (void);
 Object add_method (Object generic, Object method);
 Object make_generic_function (Object name, Object params, Object methods);
@@ -48,7 +73,10 @@ Object make_generic_function_driver (Object args);
 Object sorted_applicable_methods (Object fun, Object sample_args);
 Object function_specializers (Object meth);
 Object applicable_method_p (Object fun, Object sample_args, int strict_check);
+int applicable_method_argv (Object meth, int argc, Object *argv);
 Object generic_function_methods (Object gen);
+struct signature *function_signature (Object fun);
+int keyword_position (struct keyword_index *index, Object keyword);
 
 #ifdef USE_METHOD_CACHING
 Object recalc_next_methods (Object fun, Object meth, Object sample_args);
@@ -139,6 +139,8 @@ GLOBAL Object mutable_collection_class;
 GLOBAL Object sequence_class;
 GLOBAL Object table_class;
 GLOBAL Object object_table_class;
+GLOBAL Object weak_key_table_class;
+GLOBAL Object weak_value_table_class;
 GLOBAL Object deque_class;
 GLOBAL Object array_class;
 GLOBAL Object condition_class;
@@ -162,7 +164,6 @@ GLOBAL Object method_class;
 GLOBAL Object exit_function_class;
 GLOBAL Object unwind_protect_function_class;
 GLOBAL Object class_class;
-GLOBAL Object table_entry_class;
 GLOBAL Object deque_entry_class;
 GLOBAL Object limited_int_class;
 GLOBAL Object singleton_class;
@@ -557,6 +557,36 @@ copy_list (Object lst)
     return result;
 }
 
+/* a list of the num objects in els. */
+Object
+list_from_array (int num, Object *els)
+{
+    Object result;
+
+    result = make_empty_list ();
+    while (num > 0) {
+	result = cons (els[--num], result);
+    }
+    return result;
+}
+
+/* the elements of lst in an array: buf when they fit in its size
+   slots, fresh memory otherwise.  *num is set to their count. */
+Object *
+list_to_array (Object lst, int *num, Object *buf, int size)
+{
+    Object *els;
+    int i;
+
+    *num = list_length (lst);
+    els = (*num <= size) ? buf
+	: (Object *) marlais_allocate_memory (*num * sizeof (Object));
+    for (i = 0; PAIRP (lst); lst = CDR (lst)) {
+	els[i++] = CAR (lst);
+    }
+    return els;
+}
+
 Object
 add_new_at_end (Object *lst, Object elt)
 {
@@ -68,6 +68,8 @@ int list_equal (Object l1, Object l2);
 Object list_reverse (Object lst);
 Object list_reverse_bang (Object lst);
 Object copy_list (Object lst);
+Object list_from_array (int num, Object *els);
+Object *list_to_array (Object lst, int *num, Object *buf, int size);
 
 Object add_new_at_end (Object *lst, Object elt);
 Object list_sort (Object lst, Object test);
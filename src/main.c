@@ -6,9 +6,11 @@
 #include "common.h"
 
 #include "alloc.h"
+#include "analyze.h"
 #include "apply.h"
 #include "array.h"
 #include "boolean.h"
+#include "bytecode.h"
 #include "bytestring.h"
 #include "character.h"
 #include "class.h"
@@ -102,7 +104,7 @@ static int read_eval_print(FILE* f, int dbg_lvl, int bind_constant_p)
   Object obj;
 
   if ((obj = parse_object (f, dbg_lvl)) && (obj != eof_object)) {
-    obj = eval (obj);
+    obj = eval (analyze (obj));
     if(POINTERP(obj) && POINTERTYPE(obj) == Values) {
       vals = VALUESNUM(obj);
     }
@@ -294,7 +296,11 @@ main (int argc, char *argv[])
     }
     load_file_context = 0;
     the_env = cache_env;
-    eval_stack = 0;
+    set_eval_stack_depth (0);
+    result_types_depth = 0;
+#ifdef USE_CONTINUATION_STACK
+    continuation_top = NULL;
+#endif
     push_eval_stack (current_module ()->sym);
     num_debug_contexts = 0;
     prompt = "? ";
@@ -324,9 +330,6 @@ initialize_marlais (void)
   all_symbol = make_symbol ("all");
   (current_module ())->exported_bindings = all_symbol;
 
-  /* initialize symbol table primitives -- MUST BE DONE EARLY!! */
-  init_symbol_prims ();
-
   /* intialize global objects */
   marlais_initialize_boolean ();
 
@@ -485,6 +488,8 @@ initialize_marlais (void)
 
   /* initialize table of syntax operators and functions */
   init_syntax_table ();
+  init_analyze ();
+  init_bytecode ();
   init_reserved_word_symbols ();
   define_test_symbol = make_symbol ("define-test");
   test_symbol = make_symbol ("test");
@@ -497,6 +502,7 @@ initialize_marlais (void)
   init_class_hierarchy ();
 
   unspecified_object = make_unspecified_object ();
+  tail_call_object = make_unspecified_object ();
 
   /* make the unspecified object available */
   add_top_level_binding (make_symbol ("%unspecified"),
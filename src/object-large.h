@@ -64,10 +64,12 @@ struct pair {
 
 struct byte_string {
     int size;
+    unsigned int hash;		/* 0 until computed */
     char *val;
 };
 
 #define BYTESTRSIZE(obj)  ((obj)->u.byte_string.size)
+#define BYTESTRHASH(obj)  ((obj)->u.byte_string.hash)
 #define BYTESTRVAL(obj)   ((obj)->u.byte_string.val)
 #define BYTESTRP(obj)     ((obj)->type == ByteString)
 #define BYTESTRTYPE(obj)  ((obj)->type)
@@ -82,28 +84,24 @@ struct simple_object_vector {
 #define SOVP(obj)         ((obj)->type == SimpleObjectVector)
 #define SOVTYPE(obj)      ((obj)->type)
 
-struct table_entry {
-    int row;
-    Object key;
-    Object value;
-    Object next;
-};
-
-#define TEROW(obj)        ((obj)->u.table_entry.row)
-#define TEKEY(obj)        ((obj)->u.table_entry.key)
-#define TEVALUE(obj)      ((obj)->u.table_entry.value)
-#define TENEXT(obj)       ((obj)->u.table_entry.next)
-#define TEP(obj)          ((obj)->type == TableEntry)
-#define TETYPE(obj)       ((obj)->type)
-
 struct table {
     int size;
-    Object *the_table;
+    int count;
+    int shift;
+    unsigned int *hashes;
+    Object *keys;
+    Object *values;
 };
 
 #define TABLESIZE(obj)    ((obj)->u.table.size)
-#define TABLETABLE(obj)   ((obj)->u.table.the_table)
-#define TABLEP(obj)       ((obj)->type == ObjectTable)
+#define TABLECOUNT(obj)   ((obj)->u.table.count)
+#define TABLESHIFT(obj)   ((obj)->u.table.shift)
+#define TABLEHASHES(obj)  ((obj)->u.table.hashes)
+#define TABLEKEYS(obj)    ((obj)->u.table.keys)
+#define TABLEVALUES(obj)  ((obj)->u.table.values)
+#define TABLEP(obj)       ((obj)->type == ObjectTable \
+			   || (obj)->type == WeakKeyTable \
+			   || (obj)->type == WeakValueTable)
 #define TABLETYPE(obj)    ((obj)->type)
 
 struct deque_entry {
@@ -152,9 +150,13 @@ struct condition {
 
 struct symbol {
     char *name;
+    unsigned int hash;		/* of the case-folded name */
+    int length;
 };
 
 #define SYMBOLNAME(obj)   ((obj)->u.symbol.name)
+#define SYMBOLHASH(obj)   ((obj)->u.symbol.hash)
+#define SYMBOLLENGTH(obj) ((obj)->u.symbol.length)
 #define SYMBOLP(obj)      ((obj)->type == Symbol)
 #define SYMBOLTYPE(obj)   ((obj)->type)
 #define KEYNAME(obj)      ((obj)->u.symbol.name)
@@ -215,6 +217,9 @@ struct clas {
     int properties;
     int ordinal_index;
     struct frame *creation_env;
+    unsigned long *ancestors;	/* bit by CLASSINDEX for itself and supers */
+    int ancestor_words;
+    struct instance_layout *layout;	/* made by the first make */
 };
 
 #define CLASSNAME(obj)     ((obj)->u.clas.name)
@@ -242,12 +247,18 @@ struct clas {
 #define CLASSUNINITIALIZED(obj)  (CLASSP (obj) && (CLASSPROPS (obj) & CLASSSLOTSUNINIT))
 #define CLASSENV(obj)      ((obj)->u.clas.creation_env)
 #define CLASSINDEX(obj)    ((obj)->u.clas.ordinal_index)
+#define CLASSANCESTORS(obj) ((obj)->u.clas.ancestors)
+#define CLASSANCESTORWORDS(obj) ((obj)->u.clas.ancestor_words)
+#define CLASSLAYOUT(obj) ((obj)->u.clas.layout)
 
 struct instance {
     Object class;
-    Object *slots;
+    Object slots[1];		/* as many as the class has */
 };
 
+#define INSTANCE_SIZE(n) \
+  (offsetof (struct object, u.instance.slots) + (n) * sizeof (Object))
+
 #define INSTCLASS(obj)    ((obj)->u.instance.class)
 #define INSTSLOTS(obj)    ((obj)->u.instance.slots)
 #define INSTANCEP(obj)    ((obj)->type == Instance)
@@ -315,8 +326,9 @@ struct generic_function {
     Object required_return_types;
     Object rest_return_type;
     Object methods;
-    Object method_cache;
+    struct dispatch_node *dispatch;
     Object active_next_methods;
+    struct signature *signature;
 };
 
 #define GFNAME(obj)       ((obj)->u.generic_function.name)
@@ -331,8 +343,9 @@ struct generic_function {
 #define GFREQVALUES(obj)  ((obj)->u.generic_function.required_return_types)
 #define GFRESTVALUES(obj) ((obj)->u.generic_function.rest_return_type)
 #define GFMETHODS(obj)    ((obj)->u.generic_function.methods)
-#define GFCACHE(obj)      ((obj)->u.generic_function.method_cache)
+#define GFDISPATCH(obj)   ((obj)->u.generic_function.dispatch)
 #define GFACTIVENM(obj)   ((obj)->u.generic_function.active_next_methods)
+#define GFSIG(obj)        ((obj)->u.generic_function.signature)
 #define GFUNP(obj)        ((obj)->type == GenericFunction)
 #define GFTYPE(obj)       ((obj)->type)
 
@@ -348,12 +361,21 @@ struct method {
     Object my_handle;
     Object body;
     struct frame *env;
+    struct bytecode *code;
+    struct signature *signature;
+    struct keyword_index *key_index;
+    int frame_size;
+    int slot_num;		/* of a slot getter or setter */
 };
 
 #define METHNAME(obj)       ((obj)->u.method.name)
 #define METHPROPS(obj)      ((obj)->u.method.properties)
 #define METHALLKEYSMASK     0x01
 #define METHALLKEYS(obj)    (METHPROPS(obj) & METHALLKEYSMASK)
+#define METHGETTERMASK      0x02
+#define METHSETTERMASK      0x04
+#define METHCLASSSLOTMASK   0x08
+#define METHACCESSOR(obj)   (METHPROPS(obj) & (METHGETTERMASK | METHSETTERMASK))
 #define METHREQPARAMS(obj)  ((obj)->u.method.required_params)
 #define METHNEXTMETH(obj)   ((obj)->u.method.next_method)
 #define METHKEYPARAMS(obj)  ((obj)->u.method.key_params)
@@ -362,7 +384,12 @@ struct method {
 #define METHRESTVALUES(obj) ((obj)->u.method.rest_return_type)
 #define METHBODY(obj)       ((obj)->u.method.body)
 #define METHENV(obj)        ((obj)->u.method.env)
+#define METHCODE(obj)       ((obj)->u.method.code)
+#define METHFRAMESIZE(obj)  ((obj)->u.method.frame_size)
 #define METHHANDLE(obj)     ((obj)->u.method.my_handle)
+#define METHSIG(obj)        ((obj)->u.method.signature)
+#define METHKEYINDEX(obj)   ((obj)->u.method.key_index)
+#define METHSLOTNUM(obj)    ((obj)->u.method.slot_num)
 #define METHODP(obj)        ((obj)->type == Method)
 #define METHTYPE(obj)       ((obj)->type)
 
@@ -451,6 +478,30 @@ struct environment {
 #define ENVIRONMENTP(obj)        (POINTERP(obj) && (POINTERTYPE(obj) == Environment))
 #define ENVIRONMENTTYPE(obj)     ((obj)->type)
 
+/* pre-analyzed expression (see analyze.c) */
+
+enum code_kind {
+    ConstantCode, SyntaxCode, CallCode
+};
+
+struct code {
+    enum code_kind kind;
+    Object form;
+    Object value;
+    Object operator;
+    Object operands;
+    Object (*syntax) (Object);
+};
+
+#define CODETYPE(obj)      ((obj)->type)
+#define CODEKIND(obj)      ((obj)->u.code.kind)
+#define CODEFORM(obj)      ((obj)->u.code.form)
+#define CODEVALUE(obj)     ((obj)->u.code.value)
+#define CODEOPERATOR(obj)  ((obj)->u.code.operator)
+#define CODEOPERANDS(obj)  ((obj)->u.code.operands)
+#define CODESYNTAX(obj)    ((obj)->u.code.syntax)
+#define CODEP(obj)         (POINTERP(obj) && (POINTERTYPE(obj) == Code))
+
 struct object_handle {
     Object the_object;
 };
@@ -490,10 +541,10 @@ struct object {
 	struct exitproc exitproc;
 	struct unwind unwind;
 	struct environment environment;
+	struct code code;
 #ifdef NO_COMMON_DYLAN_SPEC
 	struct stream stream;
 #endif
-	struct table_entry table_entry;
 	struct deque_entry deque_entry;
 	struct foreign_ptr foreign_ptr;
 	struct object_handle object_handle;
@@ -116,11 +116,13 @@ struct pair {
 struct byte_string {
     ObjectType type;
     int size;
+    unsigned int hash;		/* 0 until computed */
     char *val;
 };
 
 #define BYTESTRTYPE(obj)  (((struct byte_string *)obj)->type)
 #define BYTESTRSIZE(obj)  (((struct byte_string *)obj)->size)
+#define BYTESTRHASH(obj)  (((struct byte_string *)obj)->hash)
 #define BYTESTRVAL(obj)   (((struct byte_string *)obj)->val)
 #define BYTESTRP(obj)     (POINTERP(obj) && (BYTESTRTYPE(obj) == ByteString))
 
@@ -135,31 +137,26 @@ struct simple_object_vector {
 #define SOVELS(obj)       (((struct simple_object_vector *)obj)->els)
 #define SOVP(obj)         (POINTERP(obj) && (SOVTYPE(obj) == SimpleObjectVector))
 
-struct table_entry {
-    ObjectType type;
-    int row;
-    Object key;
-    Object value;
-    Object next;
-};
-
-#define TETYPE(obj)       (((struct table_entry *)obj)->type)
-#define TEROW(obj)        (((struct table_entry *)obj)->row)
-#define TEKEY(obj)        (((struct table_entry *)obj)->key)
-#define TEVALUE(obj)      (((struct table_entry *)obj)->value)
-#define TENEXT(obj)       (((struct table_entry *)obj)->next)
-#define TEP(obj)          (POINTERP(obj) && (TETYPE(obj) == TableEntry))
-
 struct table {
     ObjectType type;
     int size;
-    Object *the_table;
+    int count;
+    int shift;
+    unsigned int *hashes;
+    Object *keys;
+    Object *values;
 };
 
 #define TABLETYPE(obj)    (((struct table *)obj)->type)
 #define TABLESIZE(obj)    (((struct table *)obj)->size)
-#define TABLETABLE(obj)   (((struct table *)obj)->the_table)
-#define TABLEP(obj)       (POINTERP(obj) && (TABLETYPE(obj) == ObjectTable))
+#define TABLECOUNT(obj)   (((struct table *)obj)->count)
+#define TABLESHIFT(obj)   (((struct table *)obj)->shift)
+#define TABLEHASHES(obj)  (((struct table *)obj)->hashes)
+#define TABLEKEYS(obj)    (((struct table *)obj)->keys)
+#define TABLEVALUES(obj)  (((struct table *)obj)->values)
+#define TABLEP(obj)       (POINTERP(obj) && (TABLETYPE(obj) == ObjectTable \
+					     || TABLETYPE(obj) == WeakKeyTable \
+					     || TABLETYPE(obj) == WeakValueTable))
 
 struct deque_entry {
     ObjectType type;
@@ -212,10 +209,14 @@ struct condition {
 struct symbol {
     ObjectType type;
     char *name;
+    unsigned int hash;		/* of the case-folded name */
+    int length;
 };
 
 #define SYMBOLTYPE(obj)   (((struct symbol *)obj)->type)
 #define SYMBOLNAME(obj)   (((struct symbol *)obj)->name)
+#define SYMBOLHASH(obj)   (((struct symbol *)obj)->hash)
+#define SYMBOLLENGTH(obj) (((struct symbol *)obj)->length)
 #define SYMBOLP(obj)      (POINTERP(obj) && (SYMBOLTYPE(obj) == Symbol))
 #define KEYNAME(obj)      (((struct symbol *)obj)->name)
 #define KEYWORDP(obj)     (POINTERP(obj) && (SYMBOLTYPE(obj) == Keyword))
@@ -270,6 +271,9 @@ struct clas {
     int ordinal_index;
     int properties;
     struct frame *creation_env;
+    unsigned long *ancestors;	/* bit by CLASSINDEX for itself and supers */
+    int ancestor_words;
+    struct instance_layout *layout;	/* made by the first make */
 };
 
 #define CLASSTYPE(obj)    (((struct clas *)obj)->type)
@@ -297,13 +301,18 @@ struct clas {
 #define CLASSUNINITIALIZED(obj)  (CLASSP (obj) && (CLASSPROPS (obj) & CLASSSLOTSUNINIT))
 #define CLASSENV(obj)     (((struct clas *)obj)->creation_env)
 #define CLASSINDEX(obj)     (((struct clas *)obj)->ordinal_index)
+#define CLASSANCESTORS(obj) (((struct clas *)obj)->ancestors)
+#define CLASSANCESTORWORDS(obj) (((struct clas *)obj)->ancestor_words)
+#define CLASSLAYOUT(obj) (((struct clas *)obj)->layout)
 
 struct instance {
     ObjectType type;
     Object class;
-    Object *slots;
+    Object slots[1];		/* as many as the class has */
 };
 
+#define INSTANCE_SIZE(n)  (sizeof (struct instance) + ((n) - 1) * sizeof (Object))
+
 #define INSTTYPE(obj)     (((struct instance *)obj)->type)
 #define INSTCLASS(obj)    (((struct instance *)obj)->class)
 #define INSTSLOTS(obj)    (((struct instance *)obj)->slots)
@@ -380,8 +389,9 @@ struct generic_function {
     Object required_return_types;
     Object rest_return_type;
     Object methods;
-    Object method_cache;
+    struct dispatch_node *dispatch;
     Object active_next_methods;
+    struct signature *signature;
 };
 
 #define GFTYPE(obj)       (((struct generic_function *)obj)->type)
@@ -398,8 +408,9 @@ struct generic_function {
 #define GFREQVALUES(obj)  (((struct generic_function *)obj)->required_return_types)
 #define GFRESTVALUES(obj) (((struct generic_function *)obj)->rest_return_type)
 #define GFMETHODS(obj)    (((struct generic_function *)obj)->methods)
-#define GFCACHE(obj)      (((struct generic_function *)obj)->method_cache)
+#define GFDISPATCH(obj)   (((struct generic_function *)obj)->dispatch)
 #define GFACTIVENM(obj)   (((struct generic_function *)obj)->active_next_methods)
+#define GFSIG(obj)        (((struct generic_function *)obj)->signature)
 #define GFUNP(obj)        (POINTERP(obj) && (GFTYPE(obj) == GenericFunction))
 
 struct method {
@@ -415,6 +426,11 @@ struct method {
     Object body;
     Object my_handle;
     struct frame *env;
+    struct bytecode *code;
+    struct signature *signature;
+    struct keyword_index *key_index;
+    int frame_size;
+    int slot_num;		/* of a slot getter or setter */
 };
 
 #define METHTYPE(obj)       (((struct method *)obj)->type)
@@ -423,6 +439,10 @@ struct method {
 #define METHPROPS(obj)      (((struct method *)obj)->properties)
 #define METHALLKEYSMASK     0x01
 #define METHALLKEYS(obj)    (METHPROPS(obj) & METHALLKEYSMASK)
+#define METHGETTERMASK      0x02
+#define METHSETTERMASK      0x04
+#define METHCLASSSLOTMASK   0x08
+#define METHACCESSOR(obj)   (METHPROPS(obj) & (METHGETTERMASK | METHSETTERMASK))
 #define METHREQPARAMS(obj)  (((struct method *)obj)->required_params)
 #define METHKEYPARAMS(obj)  (((struct method *)obj)->key_params)
 #define METHRESTPARAM(obj)  (((struct method *)obj)->rest_param)
@@ -430,7 +450,12 @@ struct method {
 #define METHRESTVALUES(obj) (((struct method *)obj)->rest_return_type)
 #define METHBODY(obj)       (((struct method *)obj)->body)
 #define METHENV(obj)        (((struct method *)obj)->env)
+#define METHCODE(obj)       (((struct method *)obj)->code)
+#define METHFRAMESIZE(obj)  (((struct method *)obj)->frame_size)
 #define METHHANDLE(obj)     (((struct method *)obj)->my_handle)
+#define METHSIG(obj)        (((struct method *)obj)->signature)
+#define METHKEYINDEX(obj)   (((struct method *)obj)->key_index)
+#define METHSLOTNUM(obj)    (((struct method *)obj)->slot_num)
 #define METHODP(obj)        (POINTERP(obj) && (METHTYPE(obj) == Method))
 
 struct next_method {
@@ -521,6 +546,31 @@ struct environment {
 #define ENVIRONMENTP(obj)        (POINTERP(obj) && (POINTERTYPE(obj) == Environment))
 #define ENVIRONMENTTYPE(obj)     (((struct environment *)obj)->type)
 
+/* pre-analyzed expression (see analyze.c) */
+
+enum code_kind {
+    ConstantCode, SyntaxCode, CallCode
+};
+
+struct code {
+    ObjectType type;
+    enum code_kind kind;
+    Object form;
+    Object value;
+    Object operator;
+    Object operands;
+    Object (*syntax) (Object);
+};
+
+#define CODETYPE(obj)      (((struct code *)obj)->type)
+#define CODEKIND(obj)      (((struct code *)obj)->kind)
+#define CODEFORM(obj)      (((struct code *)obj)->form)
+#define CODEVALUE(obj)     (((struct code *)obj)->value)
+#define CODEOPERATOR(obj)  (((struct code *)obj)->operator)
+#define CODEOPERANDS(obj)  (((struct code *)obj)->operands)
+#define CODESYNTAX(obj)    (((struct code *)obj)->syntax)
+#define CODEP(obj)         (POINTERP(obj) && (CODETYPE(obj) == Code))
+
 struct object_handle {
     ObjectType type;
     Object the_object;
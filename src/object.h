@@ -6,6 +6,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdarg.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <setjmp.h>
 
@@ -20,7 +21,7 @@ typedef enum {
 
     /* collections */
     EmptyList, Pair, ByteString, SimpleObjectVector,
-    ObjectTable, Deque, Array,
+    ObjectTable, WeakKeyTable, WeakValueTable, Deque, Array,
 
     /* conditions */
     Condition,
@@ -42,10 +43,13 @@ typedef enum {
 #ifdef NO_COMMON_DYLAN_SPEC
 Stream,
 #endif
-    TableEntry, UninitializedSlotValue, DequeEntry,
+    UninitializedSlotValue, DequeEntry,
     ObjectHandle,
     ForeignPtr,			/* <pcb> */
-    Environment
+    Environment,
+    Code,
+
+    ObjectTypeCount		/* not a type: the number of them */
 } ObjectType;
 
 #ifdef SMALL_OBJECTS
@@ -96,7 +100,7 @@ extern Object symbol_class, keyword_class;
 extern Object character_class;
 extern Object function_class, primitive_class, generic_function_class,
   method_class;
-extern Object class_class, table_entry_class, deque_entry_class;
+extern Object class_class, deque_entry_class;
 
 #ifdef NO_COMMON_DYLAN_SPEC
 stream_class,
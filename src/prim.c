@@ -41,9 +41,11 @@ make_primitive (char *name, enum primtype type, Object (*fun) ())
   return (obj);
 }
 
-/* I think this could be handled WAAAY better -- dma */
+/* apply prim to the argc arguments in argv.  only the #rest
+   primitives see a list, made here from what is left over; as
+   before, fixed arity primitives ignore any extra arguments. */
 Object
-apply_prim (Object prim, Object args)
+apply_prim (Object prim, int argc, Object *argv)
 {
   Object (*fun) ();
 
@@ -52,69 +54,80 @@ apply_prim (Object prim, Object args)
   case prim_0:
     return (*fun) ();
   case prim_1:
-    return (*fun) (FIRST (args));
+    if (argc < 1) {
+      break;
+    }
+    return (*fun) (argv[0]);
   case prim_2:
-    return (*fun) (FIRST (args), SECOND (args));
+    if (argc < 2) {
+      break;
+    }
+    return (*fun) (argv[0], argv[1]);
   case prim_3:
-    return (*fun) (FIRST (args), SECOND (args), THIRD (args));
+    if (argc < 3) {
+      break;
+    }
+    return (*fun) (argv[0], argv[1], argv[2]);
   case prim_0_1:
-    switch (list_length (args)) {
+    switch (argc) {
     case 0:
       return (*fun) (NULL);
     case 1:
-      return (*fun) (FIRST (args));
-    default:
-      marlais_error ("incorrect number of args to primitive", prim, NULL);
+      return (*fun) (argv[0]);
     }
+    break;
   case prim_0_2:
-    switch (list_length (args)) {
+    switch (argc) {
     case 0:
       return (*fun) (NULL, NULL);
     case 1:
-      return (*fun) (FIRST (args), NULL);
+      return (*fun) (argv[0], NULL);
     case 2:
-      return (*fun) (FIRST (args), SECOND (args));
-    default:
-      marlais_error ("incorrect number of args to primitive", prim, NULL);
+      return (*fun) (argv[0], argv[1]);
     }
+    break;
   case prim_0_3:
-    switch (list_length (args)) {
+    switch (argc) {
     case 0:
       return (*fun) (NULL, NULL, NULL);
     case 1:
-      return (*fun) (FIRST (args), NULL, NULL);
+      return (*fun) (argv[0], NULL, NULL);
     case 2:
-      return (*fun) (FIRST (args), SECOND (args), NULL);
+      return (*fun) (argv[0], argv[1], NULL);
     case 3:
-      return (*fun) (FIRST (args), SECOND (args), THIRD (args));
-    default:
-      marlais_error ("incorrect number of args to primitive", prim, NULL);
+      return (*fun) (argv[0], argv[1], argv[2]);
     }
+    break;
   case prim_1_1:
-    switch (list_length (args)) {
+    switch (argc) {
     case 1:
-      return (*fun) (FIRST (args), NULL);
+      return (*fun) (argv[0], NULL);
     case 2:
-      return (*fun) (FIRST (args), SECOND (args));
-    default:
-      marlais_error ("incorrect number of args to primitive", prim, NULL);
+      return (*fun) (argv[0], argv[1]);
     }
+    break;
   case prim_2_1:
-    switch (list_length (args)) {
+    switch (argc) {
     case 2:
-      return (*fun) (FIRST (args), SECOND (args), NULL);
+      return (*fun) (argv[0], argv[1], NULL);
     case 3:
-      return (*fun) (FIRST (args), SECOND (args), THIRD (args));
-    default:
-      return marlais_error ("incorrect number of args to primitive", prim, 0);
+      return (*fun) (argv[0], argv[1], argv[2]);
     }
+    break;
   case prim_0_rest:
-    return (*fun) (args);
+    return (*fun) (list_from_array (argc, argv));
   case prim_1_rest:
-    return (*fun) (CAR (args), CDR (args));
+    if (argc < 1) {
+      break;
+    }
+    return (*fun) (argv[0], list_from_array (argc - 1, argv + 1));
   case prim_2_rest:
-    return (*fun) (FIRST (args), SECOND (args), CDR (CDR (args)));
+    if (argc < 2) {
+      break;
+    }
+    return (*fun) (argv[0], argv[1], list_from_array (argc - 2, argv + 2));
   default:
     return marlais_error ("cannot handle primitive type", prim, NULL);
   }
+  return marlais_error ("incorrect number of args to primitive", prim, NULL);
 }
@@ -39,6 +39,6 @@
 
 void init_prims (int num, struct primitive prims[]);
 Object make_primitive (char *name, enum primtype type, Object (*fun) ());
-Object apply_prim (Object prim, Object args);
+Object apply_prim (Object prim, int argc, Object *argv);
 
 #endif
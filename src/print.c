@@ -122,6 +122,8 @@ marlais_print_object (Object fd, Object obj, int escaped)
 	  print_string (fd, obj, escaped);
 	  break;
     case ObjectTable:
+    case WeakKeyTable:
+    case WeakValueTable:
 	  fprintf (fp, "{table}");
 	  break;
     case Deque:
@@ -192,9 +194,6 @@ marlais_print_object (Object fd, Object obj, int escaped)
     case Unwind:
 	  fprintf (fp, "{unwind protect}");
 	  break;
-    case TableEntry:
-	  fprintf (fp, "{table entry}");
-	  break;
     case UninitializedSlotValue:
 	  fprintf (fp, "{uninitialized slot value}");
 	  break;
@@ -216,6 +215,9 @@ marlais_print_object (Object fd, Object obj, int escaped)
 	  print_env (ENVIRONMENT (obj));
 	  fprintf (fp, "}");
 	  break;
+    case Code:
+	  marlais_print_object (fd, CODEFORM (obj), escaped);
+	  break;
     default:
 	  marlais_error ("print: unknown object type", NULL);
     }
@@ -394,7 +396,7 @@ print_slot_values (Object fd, Object instance, Object slotds, int escaped)
 	  fprintf (fp, ", ");
 	  marlais_print_object (fd, GFNAME (SLOTDGETTER (CAR (slotds))), escaped);
 	  fprintf (fp, " = ");
-	  apply_print (fd, CAR (INSTSLOTS (instance)[i]), escaped);
+	  apply_print (fd, INSTSLOTS (instance)[i], escaped);
     }
 }
 
@@ -437,8 +439,7 @@ print_virtual_slot_values (Object fd, Object instance, Object slotds,
 	  fprintf (fp, ", ");
 	  marlais_print_object (fd, SLOTDGETTER (slotd), escaped);
 	  fprintf (fp, " = ");
-	  apply_print (fd, apply_internal (SLOTDGETTER (slotd),
-									   cons (instance, make_empty_list ())),
+	  apply_print (fd, apply_internal (SLOTDGETTER (slotd), 1, &instance),
 				   escaped);
     }
 }
@@ -7,6 +7,7 @@
 #include "class.h"
 #include "error.h"
 #include "eval.h"
+#include "function.h"
 #include "keyword.h"
 #include "list.h"
 #include "prim.h"
@@ -157,20 +158,43 @@ slot_allocation (Object slot)
 Object
 slot_value (Object instance, Object slot_num)
 {
-    return CAR (INSTSLOTS (instance)[INTVAL (slot_num)]);
+    return INSTSLOTS (instance)[INTVAL (slot_num)];
 }
 
 Object
 set_slot_value (Object instance, Object slot_num, Object val)
 {
-    CAR (INSTSLOTS (instance)[INTVAL (slot_num)]) = val;
+    INSTSLOTS (instance)[INTVAL (slot_num)] = val;
     return val;
 }
 
+/* run meth, a slot getter or setter, on the arguments its generic
+   function chose it for; no frame is needed. */
+Object
+apply_slot_accessor (Object meth, Object *argv)
+{
+    Object holder;
+
+    if (METHPROPS (meth) & METHSETTERMASK) {
+	holder = argv[1];
+	if (METHPROPS (meth) & METHCLASSSLOTMASK) {
+	    holder = CLASSCSLOTS (METHSIG (meth)->specializers[1]);
+	}
+	INSTSLOTS (holder)[METHSLOTNUM (meth)] = argv[0];
+	return (argv[0]);
+    } else {
+	holder = argv[0];
+	if (METHPROPS (meth) & METHCLASSSLOTMASK) {
+	    holder = CLASSCSLOTS (METHSIG (meth)->specializers[0]);
+	}
+	return (INSTSLOTS (holder)[METHSLOTNUM (meth)]);
+    }
+}
+
 static Object
 instance_slots (Object instance)
 {
-    return (Object) (&INSTSLOTS (instance));
+    return (Object) (INSTSLOTS (instance));
 }
 
 static Object
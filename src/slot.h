@@ -48,6 +48,7 @@ Object slot_required_init_keyword (Object slot);
 Object slot_allocation (Object slot);
 Object slot_value (Object instance, Object name);
 Object set_slot_value (Object instance, Object name, Object val);
+Object apply_slot_accessor (Object meth, Object *argv);
 Object make_slot_descriptor (unsigned char properties, Object getter,
 			     Object setter, Object type, Object init,
 			     Object init_keyword, Object allocation,
@@ -32,7 +32,6 @@
  */
 
 #include <string.h>
-#include <ctype.h>
 
 #include "symbol.h"
 
@@ -42,32 +41,20 @@
 /* local function prototypes
  */
 static Object intern_symbol (char *name);
-
-#ifdef NO_STRCASECMP
-int strcasecmp (unsigned char *s1, unsigned char *s2);
-
-#endif
+static void grow_symbol_table (void);
 
 /* local data
  */
 
-/* If SYMTAB_SIZE is not a power of 2, see change required below. */
-#define SYMTAB_SIZE 1024
-struct symtab *symbol_table[SYMTAB_SIZE];
-unsigned char chartable[1 << sizeof (char) * 8];
+/* the interned symbols, open-addressed by folded hash over a power of
+   two slots and kept at most three quarters full. */
+#define SYMTAB_INITIAL_SIZE 2048
+static Object *symbol_table;
+static int symbol_table_size;
+static int symbol_count;
 
 /* function definitions
  */
-void
-init_symbol_prims (void)
-{
-  int c;
-
-  for (c = 0; c < (1 << sizeof (char) * 8); c++) {
-    chartable[c] = tolower (c);
-  }
-}
-
 Object
 make_symbol (char *name)
 {
@@ -94,7 +81,7 @@ make_setter_symbol (Object sym)
   size_t namelen;
   char *name;
 
-  namelen = 1 + strlen(SYMBOLNAME(sym)) + strlen("-setter");
+  namelen = 1 + SYMBOLLENGTH (sym) + strlen("-setter");
   name = MARLAIS_ALLOCATE_STRING(namelen);
   strcpy (name, SYMBOLNAME (sym));
   strcat (name, "-setter");
@@ -102,60 +89,59 @@ make_setter_symbol (Object sym)
   return (make_symbol (name));
 }
 
-#ifdef NO_STRCASECMP
-int
-strcasecmp (unsigned char *s1, unsigned char *s2)
+static void
+grow_symbol_table (void)
 {
-  while ((chartable[*s1] == chartable[*s2++])) {
-    if (!chartable[*s1++])
-      return 0;
+  Object *old_table;
+  int i, j, old_size;
+
+  old_table = symbol_table;
+  old_size = symbol_table_size;
+  symbol_table_size = old_size ? old_size * 2 : SYMTAB_INITIAL_SIZE;
+  symbol_table = (Object *)
+    marlais_allocate_memory (symbol_table_size * sizeof (Object));
+  memset (symbol_table, 0, symbol_table_size * sizeof (Object));
+  for (i = 0; i < old_size; ++i) {
+    if (old_table[i]) {
+      j = SYMBOLHASH (old_table[i]) & (symbol_table_size - 1);
+      while (symbol_table[j]) {
+	j = (j + 1) & (symbol_table_size - 1);
+      }
+      symbol_table[j] = old_table[i];
+    }
   }
-  return (chartable[*s1] - chartable[*--s2]);
 }
-#endif
 
 static Object
 intern_symbol (char *name)
 {
-  int i;
-  unsigned h;
-  struct symtab *entry;
+  int i, length;
+  unsigned int h;
   Object sym;
 
-  h = i = 0;
-  while (name[i]) {
-    h += tolower (name[i++]);
+  if (symbol_count + 1 > symbol_table_size - symbol_table_size / 4) {
+    grow_symbol_table ();
   }
-/*
-   h = h % SYMTAB_SIZE;
- */
-
-  /* Works only if SYMTAB_SIZE is a power of 2 */
-  h &= (SYMTAB_SIZE - 1);
-
-  entry = symbol_table[h];
-  while (entry) {
-#ifdef NO_STRCASECMP
-    if (strcasecmp ((unsigned char *) name,
-		    (unsigned char *) SYMBOLNAME (entry->sym)) == 0) {
-#else
-    if (strcasecmp (name, SYMBOLNAME (entry->sym)) == 0) {
-#endif
-      return (entry->sym);
+  length = strlen (name);
+  h = marlais_hash_bytes_folded (name, length);
+  i = h & (symbol_table_size - 1);
+  while ((sym = symbol_table[i])) {
+    if (SYMBOLHASH (sym) == h && SYMBOLLENGTH (sym) == length
+	&& marlais_bytes_equal_folded (name, SYMBOLNAME (sym), length)) {
+      return (sym);
     }
-    entry = entry->next;
+    i = (i + 1) & (symbol_table_size - 1);
   }
 
     /* not found, create new entry for it. */
   sym = marlais_allocate_object (Symbol, sizeof (struct symbol));
 
   SYMBOLNAME (sym) = marlais_allocate_strdup (name);
+  SYMBOLHASH (sym) = h;
+  SYMBOLLENGTH (sym) = length;
 
-  entry = MARLAIS_ALLOCATE_STRUCT (struct symtab);
-  entry->sym = sym;
-  entry->next = symbol_table[h];
-
-  symbol_table[h] = entry;
+  symbol_table[i] = sym;
+  symbol_count++;
 
   return (sym);
 }
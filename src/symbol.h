@@ -36,14 +36,8 @@
 
 #include "common.h"
 
-struct symtab {
-    Object sym;
-    struct symtab *next;
-};
-
 Object make_symbol (char *name);
 Object make_keyword (char *name);
 Object make_setter_symbol (Object sym);
-void init_symbol_prims (void);
 
 #endif
@@ -7,6 +7,7 @@
 #include "alloc.h"
 #include "apply.h"
 #include "boolean.h"
+#include "bytecode.h"
 #include "bytestring.h"
 #include "class.h"
 #include "env.h"
@@ -36,7 +37,7 @@ extern Object description_symbol;
 extern Object error_class;
 extern Object unwind_protect_symbol;
 
-extern Object eval_combination (Object obj, int do_apply);
+extern Object eval_combination (Object obj, Object fun, int argc, Object *argv);
 
 /* data structures */
 
@@ -430,6 +431,9 @@ static Object
 bind_exit_eval (Object form)
 {
     Object exit_obj, sym, body, ret, sec;
+#ifdef USE_CONTINUATION_STACK
+    struct continuation *continuation = continuation_top;
+#endif
 
     if (EMPTYLISTP (CDR (form))) {
 	marlais_error ("malformed bind-exit form", form, NULL);
@@ -464,6 +468,10 @@ bind_exit_eval (Object form)
 	pop_scope ();
 	return (ret);
     } else {
+#ifdef USE_CONTINUATION_STACK
+	/* drop the continuations the exit was taken from */
+	continuation_top = continuation;
+#endif
 	pop_scope ();
 	return (ret);
     }
@@ -634,18 +642,34 @@ bind_variables (Object init_list,
 		int constant,
 		struct frame *to_frame)
 {
-  Object variable, variables, init, val;
-  Object first, last, new;
-  int i, value_count;
+  Object init;
 
   if (!PAIRP (init_list) || EMPTYLISTP (CDR (init_list))) {
     marlais_error ("Initializer list requires at least two elements", init_list, NULL);
   }
+  init = init_list;
+  while (!EMPTYLISTP (CDR (init))) {
+    init = CDR (init);
+  }
+  bind_values (init_list, eval (CAR (init)), top_level, constant, to_frame);
+}
+
+/* bind the variables of init_list to val, the value of its init. */
+void
+bind_values (Object init_list,
+	     Object val,
+	     int top_level,
+	     int constant,
+	     struct frame *to_frame)
+{
+  Object variable, variables, init;
+  Object first, last, new;
+  int i, value_count;
+
   variables = init = init_list;
   while (!EMPTYLISTP (CDR (init))) {
     init = CDR (init);
   }
-  val = eval (CAR (init));
   if (VALUESP (val)) {
     value_count = 0;
     while (variables != init) {
@@ -4,6 +4,7 @@
 #define SYNTAX_H
 
 #include "common.h"
+#include "env.h"
 
 /* global objects */
 extern Object type_class, initial_state_sym, next_state_sym;
@@ -30,5 +31,10 @@ typedef Object (*syntax_fun) (Object);
 void init_syntax_table (void);
 syntax_fun syntax_function (Object sym);
 Object eval_slots (Object slots);
+void bind_values (Object init_list,
+		  Object val,
+		  int top_level,
+		  int constant,
+		  struct frame *to_frame);
 
 #endif
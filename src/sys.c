@@ -34,6 +34,7 @@
 
 #include "sys.h"
 
+#include "alloc.h"
 #include "bytestring.h"
 #include "error.h"
 #include "number.h"
@@ -48,6 +49,7 @@ static struct primitive sys_prims[] =
     {"time", prim_0, get_time},
     {"clock", prim_0, get_clock},
     {"system", prim_1, user_system},
+    {"collect-garbage", prim_0, collect_garbage},
 };
 
 void
@@ -111,3 +113,10 @@ user_system (Object string)
 
     }
 }
+
+Object
+collect_garbage (void)
+{
+    marlais_collect_garbage ();
+    return unspecified_object;
+}
@@ -40,5 +40,6 @@ Object get_ctime (void);
 Object get_time (void);
 Object get_clock (void);
 Object user_system (Object string);
+Object collect_garbage (void);
 
 #endif
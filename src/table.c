@@ -38,32 +38,51 @@
 
 #include "alloc.h"
 #include "apply.h"
+#include "bytestring.h"
 #include "env.h"
 #include "error.h"
-#include "list.h"
 #include "number.h"
 #include "prim.h"
 #include "symbol.h"
 
 extern Object dylan_symbol;
 
+/* =hash values stay small integers */
+#define EQUAL_HASH_MASK 0x1fffffff
+
+#define WEAK_KEYS_P(table)   (TABLETYPE (table) == WeakKeyTable)
+#define WEAK_VALUES_P(table) (TABLETYPE (table) == WeakValueTable)
+
 /* local function prototypes */
 
+static Object make_typed_table (ObjectType type, int size);
+static void table_allocate (Object table, int size);
+static Object *table_allocate_refs (int slots, int weak);
+static void weak_store (Object *ref, Object obj);
+static void weak_release (Object *refs, int size);
+static void table_grow (Object table);
+static unsigned int table_hash (Object key);
+static int table_find (Object table, Object key, unsigned int h);
+static void table_insert (Object table, Object key, unsigned int h,
+			  Object val);
 static Object *table_element_handle (Object table,
 				     Object key,
 				     Object *default_val);
+static Object table_remove_key (Object table, Object key);
+static Object table_occupied_state (Object table, int i);
 static Object table_initial_state (Object table);
 static Object table_next_state (Object table, Object state);
 static Object table_current_element (Object table, Object state);
 static Object table_current_key (Object table, Object state);
 static Object table_current_element_setter (Object table, Object state, Object value);
+static int keys_equal (Object key1, Object key2);
+static Object dylan_equal_function (void);
+static unsigned int hash_combine (unsigned int h, unsigned int k);
+static unsigned int key_hash (Object key);
 static Object equal_hash (Object key);
-static Object hash_pair (Object pair);
-static Object hash_deque (Object deq);
-static Object hash_string (Object string);
-static Object hash_vector (Object vector);
-
-static Object table_default = NULL;
+static unsigned int hash_list (Object list);
+static unsigned int hash_deque (Object deq);
+static unsigned int hash_vector (Object vector);
 
 /* primitives */
 
@@ -71,6 +90,7 @@ static struct primitive table_prims[] =
 {
   {"%table-element", prim_3, table_element},
   {"%table-element-setter", prim_3, table_element_setter},
+  {"%table-remove-key!", prim_2, table_remove_key},
   {"%table-initial-state", prim_1, table_initial_state},
   {"%table-next-state", prim_2, table_next_state},
   {"%table-current-element", prim_2, table_current_element},
@@ -84,40 +104,37 @@ init_table_prims (void)
 {
   int num = sizeof (table_prims) / sizeof (struct primitive);
   init_prims (num, table_prims);
-  table_default = cons (MARLAIS_FALSE, MARLAIS_FALSE);
 }
 
 Object
 make_table (int size)
 {
-  Object obj = marlais_allocate_object (ObjectTable, sizeof (struct table));
-
-  TABLESIZE (obj) = size;
-  TABLETABLE (obj) = (Object *) marlais_allocate_memory (sizeof (Object) * size);
-  memset (TABLETABLE (obj), 0, sizeof (Object) * size);
-
-  return (obj);
+  return (make_typed_table (ObjectTable, size));
 }
 
-Object
-make_table_entry (int row, Object key, Object value, Object next)
+/* size is the number of entries expected; the table grows past it. */
+static Object
+make_typed_table (ObjectType type, int size)
 {
-  Object obj = marlais_allocate_object (TableEntry, sizeof (struct table_entry));
+  Object obj = marlais_allocate_object (type, sizeof (struct table));
+  int slots;
 
-  TEROW (obj) = row;
-  TEKEY (obj) = key;
-  TEVALUE (obj) = value;
-  TENEXT (obj) = next;
+  slots = MIN_TABLE_SLOTS;
+  while (slots - slots / 4 < size) {
+    slots <<= 1;
+  }
+  table_allocate (obj, slots);
+  TABLECOUNT (obj) = 0;
   return (obj);
 }
 
 Object
-make_table_driver (Object rest)
+make_table_driver (ObjectType type, Object rest)
 {
   Object size;
 
   if (EMPTYLISTP (rest)) {
-    return (make_table (DEFAULT_TABLE_SIZE));
+    return (make_typed_table (type, DEFAULT_TABLE_SIZE));
   } else if (CAR (rest) == size_keyword) {
     rest = CDR (rest);
     if (EMPTYLISTP (rest)) {
@@ -127,7 +144,7 @@ make_table_driver (Object rest)
     if (!INTEGERP (size)) {
       marlais_error ("make: argument to size keyword must be an integer", size, NULL);
     }
-    return (make_table (INTVAL (size)));
+    return (make_typed_table (type, INTVAL (size)));
   } else {
     return marlais_error ("make: bad keywords or arguments", rest, NULL);
   }
@@ -135,57 +152,175 @@ make_table_driver (Object rest)
 
 /* local functions */
 
-static int
-vectors_equal (Object vec1, Object vec2)
+/* slots is a power of two.  a zero hash marks an empty slot; a slot
+   whose weak key or value the collector has cleared keeps its hash so
+   probes run past it, until the table is next rebuilt. */
+static void
+table_allocate (Object table, int slots)
+{
+  int bits;
+
+  for (bits = 0; (1 << bits) < slots; ++bits) ;
+  TABLESIZE (table) = slots;
+  TABLESHIFT (table) = 32 - bits;
+  TABLEHASHES (table) = (unsigned int *)
+    marlais_allocate_atomic (sizeof (unsigned int) * slots);
+  memset (TABLEHASHES (table), 0, sizeof (unsigned int) * slots);
+  TABLEKEYS (table) = table_allocate_refs (slots, WEAK_KEYS_P (table));
+  TABLEVALUES (table) = table_allocate_refs (slots, WEAK_VALUES_P (table));
+}
+
+/* the collector does not trace atomic memory, so weak slots do not
+   keep their objects alive. */
+static Object *
+table_allocate_refs (int slots, int weak)
+{
+  Object *refs;
+
+  if (!weak) {
+    return (Object *) marlais_allocate_memory (sizeof (Object) * slots);
+  }
+  refs = (Object *) marlais_allocate_atomic (sizeof (Object) * slots);
+  memset (refs, 0, sizeof (Object) * slots);
+  return (refs);
+}
+
+/* store obj in a weak slot, which is cleared once nothing else
+   refers to obj. */
+static void
+weak_store (Object *ref, Object obj)
+{
+  if (*ref) {
+    marlais_unregister_weak_link ((void **) ref);
+  }
+  *ref = obj;
+  if (POINTERP (obj)) {
+    marlais_register_weak_link ((void **) ref, obj);
+  }
+}
+
+static void
+weak_release (Object *refs, int size)
 {
   int i;
 
-  if (SOVSIZE (vec1) != SOVSIZE (vec2))
-    return (0);
-  for (i = 0; i < SOVSIZE (vec1); i++) {
-    if (SOVELS (vec1)[i] != SOVELS (vec2)[i])
-      return (0);
+  for (i = 0; i < size; ++i) {
+    if (refs[i]) {
+      marlais_unregister_weak_link ((void **) &refs[i]);
+    }
+  }
+}
+
+/* rebuild from the cached hashes, dropping cleared entries, and
+   double the slots unless that leaves the table at most half full. */
+static void
+table_grow (Object table)
+{
+  unsigned int *hashes;
+  Object *keys, *values;
+  int i, j, size, mask, live;
+
+  size = TABLESIZE (table);
+  hashes = TABLEHASHES (table);
+  keys = TABLEKEYS (table);
+  values = TABLEVALUES (table);
+  for (i = 0, live = 0; i < size; ++i) {
+    if (hashes[i] && keys[i] && values[i]) {
+      ++live;
+    }
+  }
+  table_allocate (table, live + 1 > size / 2 ? size * 2 : size);
+  mask = TABLESIZE (table) - 1;
+  for (i = 0; i < size; ++i) {
+    if (hashes[i] && keys[i] && values[i]) {
+      j = TABLE_SLOT (table, hashes[i]);
+      while (TABLEHASHES (table)[j]) {
+	j = (j + 1) & mask;
+      }
+      TABLEHASHES (table)[j] = hashes[i];
+      if (WEAK_KEYS_P (table)) {
+	weak_store (&TABLEKEYS (table)[j], keys[i]);
+      } else {
+	TABLEKEYS (table)[j] = keys[i];
+      }
+      if (WEAK_VALUES_P (table)) {
+	weak_store (&TABLEVALUES (table)[j], values[i]);
+      } else {
+	TABLEVALUES (table)[j] = values[i];
+      }
+    }
+  }
+  TABLECOUNT (table) = live;
+  if (WEAK_KEYS_P (table)) {
+    weak_release (keys, size);
+  }
+  if (WEAK_VALUES_P (table)) {
+    weak_release (values, size);
   }
-  return (1);
 }
 
-Object *
-table_element_by_vector (Object table, Object key)
+static unsigned int
+table_hash (Object key)
 {
-  Object hval, entry;
-  int h;
+  unsigned int h = key_hash (key);
 
-  hval = equal_hash (key);
-  h = abs (INTVAL (hval)) % TABLESIZE (table);
-  entry = TABLETABLE (table)[h];
+  return (h ? h : 1);
+}
 
-  while (entry) {
-    if (vectors_equal (key, TEKEY (entry))) {
-      return (TEVALUE (entry));
+/* the slot holding key, or -1. */
+static int
+table_find (Object table, Object key, unsigned int h)
+{
+  Object equal_fun, args[2];
+  int i, same;
+
+  equal_fun = NULL;
+  i = TABLE_SLOT (table, h);
+  while (TABLEHASHES (table)[i]) {
+    if (TABLEHASHES (table)[i] == h && TABLEKEYS (table)[i]) {
+      same = keys_equal (TABLEKEYS (table)[i], key);
+      if (same < 0) {
+	if (!equal_fun) {
+	  equal_fun = dylan_equal_function ();
+	}
+	args[0] = TABLEKEYS (table)[i];
+	args[1] = key;
+	same = (apply_argv (equal_fun, 2, args) != MARLAIS_FALSE);
+      }
+      if (same) {
+	return (i);
+      }
     }
-    entry = TENEXT (entry);
+    i = (i + 1) & (TABLESIZE (table) - 1);
   }
-  return (NULL);
+  return (-1);
 }
 
-Object
-table_element_setter_by_vector (Object table, Object key, Object val)
+/* add an entry for a key known to be absent. */
+static void
+table_insert (Object table, Object key, unsigned int h, Object val)
 {
-  Object hval, entry;
-  Object *element_handle;
-  int h;
+  int i;
 
-  element_handle = table_element_by_vector (table, key);
-  if (element_handle) {
-    *element_handle = val;
+  if (TABLECOUNT (table) + 1 > TABLESIZE (table) - TABLESIZE (table) / 4) {
+    table_grow (table);
+  }
+  i = TABLE_SLOT (table, h);
+  while (TABLEHASHES (table)[i]) {
+    i = (i + 1) & (TABLESIZE (table) - 1);
+  }
+  TABLEHASHES (table)[i] = h;
+  if (WEAK_KEYS_P (table)) {
+    weak_store (&TABLEKEYS (table)[i], key);
   } else {
-    hval = equal_hash (key);
-    h = abs (INTVAL (hval)) % TABLESIZE (table);
-
-    entry = make_table_entry (h, key, val, TABLETABLE (table)[h]);
-    TABLETABLE (table)[h] = entry;
+    TABLEKEYS (table)[i] = key;
   }
-  return (unspecified_object);
+  if (WEAK_VALUES_P (table)) {
+    weak_store (&TABLEVALUES (table)[i], val);
+  } else {
+    TABLEVALUES (table)[i] = val;
+  }
+  TABLECOUNT (table)++;
 }
 
 Object
@@ -197,26 +332,11 @@ table_element (Object table, Object key, Object default_val)
 static Object *
 table_element_handle (Object table, Object key, Object *default_val)
 {
-  Object hval, equal_fun, entry;
-  int h;
-  struct frame *old_env;
-
-  hval = equal_hash (key);
-  h = abs (INTVAL (hval)) % TABLESIZE (table);
-  entry = TABLETABLE (table)[h];
-
-  old_env = the_env;
-  the_env = module_binding (dylan_symbol)->namespace;
-  equal_fun = symbol_value (equal_symbol);
-  the_env = old_env;
+  int i;
 
-  while (entry) {
-    if (apply (equal_fun,
-	       cons (TEKEY (entry), cons (key, make_empty_list ())))
-	!= MARLAIS_FALSE) {
-      return &(TEVALUE (entry));
-    }
-    entry = TENEXT (entry);
+  i = table_find (table, key, table_hash (key));
+  if (i >= 0 && TABLEVALUES (table)[i]) {
+    return &(TABLEVALUES (table)[i]);
   }
   if (*default_val != default_object) {
     return default_val;
@@ -225,80 +345,160 @@ table_element_handle (Object table, Object key, Object *default_val)
   }
 }
 
+/* does key1 = key2 hold?  settled here for the builtin keys whose =
+   methods are fixed, -1 when only the = function can tell. */
+static int
+keys_equal (Object key1, Object key2)
+{
+  if (INSTANCEP (key1) || INSTANCEP (key2)) {
+    return (-1);
+  }
+  if (key1 == key2) {
+    return (1);
+  }
+  if (INTEGERP (key1) && INTEGERP (key2)) {
+    return (INTVAL (key1) == INTVAL (key2));
+  }
+  if (CHARP (key1) && CHARP (key2)) {
+    return (CHARVAL (key1) == CHARVAL (key2));
+  }
+  if (BYTESTRP (key1) && BYTESTRP (key2)) {
+    return (BYTESTRSIZE (key1) == BYTESTRSIZE (key2)
+	    && memcmp (BYTESTRVAL (key1), BYTESTRVAL (key2),
+		       BYTESTRSIZE (key1)) == 0);
+  }
+  /* = is == for these against anything but an instance */
+  if (CHARP (key1) || TRUEP (key1) || FALSEP (key1)
+      || SYMBOLP (key1) || KEYWORDP (key1)
+      || CHARP (key2) || TRUEP (key2) || FALSEP (key2)
+      || SYMBOLP (key2) || KEYWORDP (key2)) {
+    return (0);
+  }
+  return (-1);
+}
+
+/* the = of the dylan module. */
+static Object
+dylan_equal_function (void)
+{
+  Object equal_fun;
+  struct frame *old_env;
+
+  old_env = the_env;
+  the_env = module_binding (dylan_symbol)->namespace;
+  equal_fun = symbol_value (equal_symbol);
+  the_env = old_env;
+  return (equal_fun);
+}
 
 Object
 table_element_setter (Object table, Object key, Object val)
 {
-  Object hval, entry;
-  Object *element_handle;
-  int h;
+  unsigned int h;
+  int i;
 
-  if ((element_handle = table_element_handle (table, key, &table_default))
-      != &table_default) {
-    *element_handle = val;
+  h = table_hash (key);
+  i = table_find (table, key, h);
+  if (i < 0) {
+    table_insert (table, key, h, val);
+  } else if (WEAK_VALUES_P (table)) {
+    weak_store (&TABLEVALUES (table)[i], val);
   } else {
-    hval = equal_hash (key);
-    h = abs (INTVAL (hval)) % TABLESIZE (table);
-    entry = make_table_entry (h, key, val, TABLETABLE (table)[h]);
-    TABLETABLE (table)[h] = entry;
+    TABLEVALUES (table)[i] = val;
   }
   return (unspecified_object);
 }
 
-/* iteration protocol */
-
+/* the slot keeps its hash, like a cleared weak entry, so probes run
+   past it and it still counts toward the load until the table is next
+   rebuilt. */
 static Object
-table_initial_state (Object table)
+table_remove_key (Object table, Object key)
 {
   int i;
 
-  for (i = 0; i < TABLESIZE (table); ++i) {
-    if (TABLETABLE (table)[i]) {
-      return (TABLETABLE (table)[i]);
-    }
+  i = table_find (table, key, table_hash (key));
+  if (i < 0) {
+    return (MARLAIS_FALSE);
   }
-  return (MARLAIS_FALSE);
+  if (WEAK_KEYS_P (table)) {
+    marlais_unregister_weak_link ((void **) &TABLEKEYS (table)[i]);
+  }
+  if (WEAK_VALUES_P (table) && TABLEVALUES (table)[i]) {
+    marlais_unregister_weak_link ((void **) &TABLEVALUES (table)[i]);
+  }
+  TABLEKEYS (table)[i] = NULL;
+  TABLEVALUES (table)[i] = NULL;
+  return (MARLAIS_TRUE);
 }
 
+/* iteration protocol.  a state is the index of an occupied slot.  a
+   weak entry cleared under an iteration reads as #f. */
+
 static Object
-table_next_state (Object table, Object state)
+table_occupied_state (Object table, int i)
 {
-  int i;
-
-  if (TENEXT (state)) {
-    return (TENEXT (state));
-  }
-  for (i = (TEROW (state) + 1); i < TABLESIZE (table); ++i) {
-    if (TABLETABLE (table)[i]) {
-      return (TABLETABLE (table)[i]);
+  for (; i < TABLESIZE (table); ++i) {
+    if (TABLEHASHES (table)[i]
+	&& TABLEKEYS (table)[i] && TABLEVALUES (table)[i]) {
+      return (marlais_make_integer (i));
     }
   }
   return (MARLAIS_FALSE);
 }
 
+static Object
+table_initial_state (Object table)
+{
+  return (table_occupied_state (table, 0));
+}
+
+static Object
+table_next_state (Object table, Object state)
+{
+  return (table_occupied_state (table, INTVAL (state) + 1));
+}
+
 static Object
 table_current_element (Object table, Object state)
 {
-  return (TEVALUE (state));
+  Object value = TABLEVALUES (table)[INTVAL (state)];
+
+  return (value ? value : MARLAIS_FALSE);
 }
 
 static Object
 table_current_key (Object table, Object state)
 {
-  return (TEKEY (state));
+  Object key = TABLEKEYS (table)[INTVAL (state)];
+
+  return (key ? key : MARLAIS_FALSE);
 }
 
 static Object
 table_current_element_setter (Object table, Object state, Object value)
 {
-  TEVALUE (state) = value;
+  if (WEAK_VALUES_P (table)) {
+    weak_store (&TABLEVALUES (table)[INTVAL (state)], value);
+  } else {
+    TABLEVALUES (table)[INTVAL (state)] = value;
+  }
   return (unspecified_object);
 }
 
-static Object
-equal_hash (Object key)
+/* an order-dependent mix of k into h. */
+static unsigned int
+hash_combine (unsigned int h, unsigned int k)
+{
+  h = (h ^ k) * 0x9e3779b1U;
+  return (h ^ (h >> 15));
+}
+
+static unsigned int
+key_hash (Object key)
 {
   Object hashfun;
+  unsigned long h;
 
   if (INSTANCEP (key)) {
     hashfun = symbol_value (equal_hash_symbol);
@@ -308,74 +508,73 @@ equal_hash (Object key)
     if (!hashfun) {
       marlais_error ("no =hash method defined for key class", key, NULL);
     }
-    return (apply (hashfun, cons (key, make_empty_list ())));
+    return ((unsigned int) INTVAL (apply_argv (hashfun, 1, &key)));
+  } else if (INTEGERP (key)) {
+    return ((unsigned int) INTVAL (key));
+  } else if (CHARP (key)) {
+    return (CHARVAL (key));
+  } else if (TRUEP (key)) {
+    return (1);
+  } else if (FALSEP (key)) {
+    return (0);
+  } else if (EMPTYLISTP (key)) {
+    return (2);
+  } else if (PAIRP (key)) {
+    return (hash_list (key));
+  } else if (DEQUEP (key)) {
+    return (hash_deque (key));
+  } else if (BYTESTRP (key)) {
+    return (marlais_bytestring_hash (key));
+  } else if (SOVP (key)) {
+    return (hash_vector (key));
+  } else if (SYMBOLP (key) || KEYWORDP (key)) {
+    return (SYMBOLHASH (key));
   } else {
-    if (INTEGERP (key)) {
-      return (key);
-    } else if (CHARP (key)) {
-      return (marlais_make_integer (CHARVAL (key)));
-    } else if (TRUEP (key)) {
-      return (marlais_make_integer (1));
-    } else if (FALSEP (key)) {
-      return (marlais_make_integer (0));
-    } else if (EMPTYLISTP (key)) {
-      return (marlais_make_integer (2));
-    } else if (PAIRP (key)) {
-      return (hash_pair (key));
-    } else if (DEQUEP (key)) {
-      return (hash_deque (key));
-    } else if (BYTESTRP (key)) {
-      return (hash_string (key));
-    } else if (SOVP (key)) {
-      return (hash_vector (key));
-    } else if (SYMBOLP (key) || KEYWORDP (key)) {
-      return (marlais_make_integer ((int) key));
-    } else {
-      /* marlais_error ("=hash: don't know how to hash object", key, NULL);  */
-      return (marlais_make_integer (((int) key)));
-    }
+    /* objects that are = only to themselves never move */
+    h = ((unsigned long) key >> 3) * 2654435769UL;
+    return ((unsigned int) (h ^ (h >> 15)));
   }
 }
 
 static Object
-hash_pair (Object pair)
+equal_hash (Object key)
 {
-  int h = INTVAL (equal_hash (CAR (pair))) + INTVAL (equal_hash (CDR (pair)));
-  return (marlais_make_integer (h));
+  return (marlais_make_integer ((int) (key_hash (key) & EQUAL_HASH_MASK)));
 }
 
-static Object
-hash_deque (Object deq)
+static unsigned int
+hash_list (Object list)
 {
-  int h = 0;
-  Object entry;
+  unsigned int h = 3;
 
-  entry = DEQUEFIRST (deq);
-  while (!EMPTYLISTP (entry)) {
-    h += INTVAL (equal_hash (DEVALUE (entry)));
-    entry = DENEXT (entry);
+  for (; PAIRP (list); list = CDR (list)) {
+    h = hash_combine (h, key_hash (CAR (list)));
   }
-  return (marlais_make_integer (h));
+  return (hash_combine (h, key_hash (list)));
 }
 
-static Object
-hash_string (Object string)
+static unsigned int
+hash_deque (Object deq)
 {
-  int i, h;
+  unsigned int h = 4;
+  Object entry;
 
-  h = 0;
-  for (i = 0; i < BYTESTRSIZE (string); ++i) {
-    h += BYTESTRVAL (string)[i];
+  entry = DEQUEFIRST (deq);
+  while (!EMPTYLISTP (entry)) {
+    h = hash_combine (h, key_hash (DEVALUE (entry)));
+    entry = DENEXT (entry);
   }
-  return (marlais_make_integer (h));
+  return (h);
 }
 
-static Object
+static unsigned int
 hash_vector (Object vector)
 {
-  int i, h = 0;
+  unsigned int h = 5;
+  int i;
+
   for (i = 0; i < SOVSIZE (vector); ++i) {
-    h += INTVAL (equal_hash (SOVELS (vector)[i]));
+    h = hash_combine (h, key_hash (SOVELS (vector)[i]));
   }
-  return (marlais_make_integer (h));
+  return (h);
 }
@@ -36,17 +36,20 @@
 
 #include "common.h"
 
-#define DEFAULT_TABLE_SIZE 101
+#define DEFAULT_TABLE_SIZE 16
+
+/* tables are open-addressed with linear probing over a power of two
+   slots, kept at most three quarters full. */
+#define MIN_TABLE_SLOTS 8
+#define TABLE_SLOT(table, h) \
+  ((int) (((h) * 2654435769U) >> TABLESHIFT (table)))
 
 extern Object equal_symbol;
 
 void init_table_prims (void);
 Object make_table (int size);
-Object make_table_entry (int row, Object key, Object value, Object next);
-Object make_table_driver (Object rest);
+Object make_table_driver (ObjectType type, Object rest);
 Object table_element_setter (Object table, Object key, Object val);
 Object table_element (Object table, Object key, Object default_val);
-Object *table_element_by_vector (Object table, Object key);
-Object table_element_setter_by_vector (Object table, Object key, Object val);
 
 #endif